@@ -0,0 +1,380 @@
+#ifndef PROJECT2_BENCHMARKS_H
+#define PROJECT2_BENCHMARKS_H
+
+#include "ConcurrentHeapPriorityQueue.h"
+#include "DynamicArray.h"
+#include "DynamicArrayPriorityQueue.h"
+#include "FlatCombiningPriorityQueue.h"
+#include "HeapPriorityQueue.h"
+#include "LockFreeSkipListPriorityQueue.h"
+#include "MultiQueue.h"
+#include "PriorityKernels.h"
+#include "QueueItem.h"
+#include "RadixHeapPriorityQueue.h"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+
+namespace Benchmarks
+{
+    /// \brief Measures the execution time of the \p function
+    /// \param function A function to measure
+    /// \return Execution time in milliseconds
+    template<typename Function>
+    double Measure(Function &&function)
+    {
+        auto start = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    /// \brief Creates an array of \p count items with random priorities
+    /// \param count Number of items
+    /// \param seed Seed of the random number generator
+    /// \return An array of items, where the element is the index of the item
+    inline DataStructures::DynamicArray<DataStructures::QueueItem<int, int>> RandomItems(int count, unsigned seed = 42)
+    {
+        std::mt19937 random(seed);
+        DataStructures::DynamicArray<DataStructures::QueueItem<int, int>> items(count);
+        for (int i = 0; i < count; ++i)
+        {
+            items.Add({i, static_cast<int>(random() >> 1)});
+        }
+
+        return items;
+    }
+
+    template<int Width>
+    void ChildSelection(const DataStructures::DynamicArray<std::int32_t> &priorities, const DataStructures::DynamicArray<int> &blocks)
+    {
+        long long scalarSum = 0;
+        long long simdSum = 0;
+        double scalar = Measure([&]()
+        {
+            for (int block: blocks)
+            {
+                scalarSum += DataStructures::SelectBestScalar(priorities.begin() + block, Width, std::less<std::int32_t>());
+            }
+        });
+        double simd = Measure([&]()
+        {
+            for (int block: blocks)
+            {
+                simdSum += DataStructures::SelectBest<Width>(priorities.begin() + block, Width, std::less<std::int32_t>());
+            }
+        });
+
+        std::cout << "Child selection, " << Width << " children: scalar " << scalar << " ms, "
+                  << (DataStructures::HasSimdKernels ? "SIMD " : "SIMD (not available) ") << simd << " ms, speedup "
+                  << scalar / simd << (scalarSum == simdSum ? "" : " (results differ!)") << std::endl;
+    }
+
+    /// \brief Compares the scalar and the vectorized selection of the greatest child in blocks of 8 and 16 priorities
+    inline void ChildSelection()
+    {
+        const int length = 1 << 16;
+        const int lookups = 1 << 22;
+
+        std::mt19937 random(7);
+        DataStructures::DynamicArray<std::int32_t> priorities(length);
+        for (int i = 0; i < length; ++i)
+        {
+            priorities.Add(static_cast<std::int32_t>(random()));
+        }
+
+        DataStructures::DynamicArray<int> blocks(lookups);
+        for (int i = 0; i < lookups; ++i)
+        {
+            blocks.Add(static_cast<int>(random() % (length / 16)) * 16);
+        }
+
+        ChildSelection<8>(priorities, blocks);
+        ChildSelection<16>(priorities, blocks);
+    }
+
+    template<int Arity>
+    double HeapDequeue(const DataStructures::DynamicArray<DataStructures::QueueItem<int, int>> &items, double baseline)
+    {
+        DataStructures::HeapPriorityQueue<int, int, std::less<int>, Arity> queue(items);
+        volatile int last = 0;
+        double time = Measure([&]()
+        {
+            while (!queue.IsEmpty())
+            {
+                last = queue.Dequeue();
+            }
+        });
+
+        std::cout << "Dequeue of " << items.GetLength() << " items, " << Arity << "-ary heap: " << time << " ms";
+        if (baseline > 0)
+        {
+            std::cout << ", speedup over binary heap " << baseline / time;
+        }
+
+        std::cout << std::endl;
+        return time;
+    }
+
+    /// \brief Compares the time of dequeuing all the items of the binary heap and the wider heaps
+    inline void HeapDequeue()
+    {
+        auto items = RandomItems(1 << 21);
+        double binary = HeapDequeue<2>(items, 0);
+        HeapDequeue<4>(items, binary);
+        HeapDequeue<8>(items, binary);
+        HeapDequeue<16>(items, binary);
+    }
+
+    /// \brief Compares the scalar and the vectorized search for the greatest priority in arrays of various lengths
+    inline void MaxScan()
+    {
+        std::mt19937 random(11);
+        for (int length: {64, 1024, 16384})
+        {
+            DataStructures::DynamicArray<std::int32_t> priorities(length);
+            for (int i = 0; i < length; ++i)
+            {
+                priorities.Add(static_cast<std::int32_t>(random()));
+            }
+
+            const int repetitions = (1 << 26) / length;
+            volatile int result = 0;
+            double scalar = Measure([&]()
+            {
+                for (int i = 0; i < repetitions; ++i)
+                {
+                    result = DataStructures::SelectBestScalar(priorities.begin(), length, std::less<std::int32_t>());
+                }
+            });
+            double simd = Measure([&]()
+            {
+                for (int i = 0; i < repetitions; ++i)
+                {
+                    result = DataStructures::FindBest(priorities.begin(), length, std::less<std::int32_t>());
+                }
+            });
+
+            std::cout << "Max scan of " << length << " priorities: scalar " << scalar << " ms, "
+                      << (DataStructures::HasSimdKernels ? "SIMD " : "SIMD (not available) ") << simd
+                      << " ms, speedup " << scalar / simd << std::endl;
+        }
+    }
+
+    /// \brief Measures the time of dequeuing all the items of the unsorted array queue
+    inline void ArrayQueueDequeue()
+    {
+        auto items = RandomItems(1 << 14);
+        DataStructures::DynamicArrayPriorityQueue<int, int> queue(items);
+        volatile int last = 0;
+        double time = Measure([&]()
+        {
+            while (!queue.IsEmpty())
+            {
+                last = queue.Peek();
+                last = queue.Dequeue();
+            }
+        });
+
+        std::cout << "Peek and dequeue of " << items.GetLength() << " items, array queue: " << time << " ms"
+                  << std::endl;
+    }
+
+    /// \brief Simulates \p events on the \p queue: every dequeued event at time t schedules a new one at a random
+    /// time after t, so the dequeued priorities never decrease. The element of every event is its time.
+    /// \return Sum of the dequeued times
+    template<typename Queue>
+    long long EventSimulation(Queue &queue, int pending, int events)
+    {
+        std::mt19937 random(13);
+        for (int i = 0; i < pending; ++i)
+        {
+            int time = static_cast<int>(random() % 1024);
+            queue.Enqueue(time, time);
+        }
+
+        long long sum = 0;
+        for (int i = 0; i < events; ++i)
+        {
+            int time = queue.Dequeue();
+            int next = time + 1 + static_cast<int>(random() % 1024);
+            queue.Enqueue(next, next);
+            sum += time;
+        }
+
+        return sum;
+    }
+
+    /// \brief Compares the radix heap with the binary min-heap on a workload of non-decreasing priorities
+    inline void MonotoneQueue()
+    {
+        const int pending = 1 << 16;
+        const int events = 1 << 22;
+
+        long long heapSum = 0;
+        long long radixSum = 0;
+        DataStructures::HeapPriorityQueue<int, int, std::greater<int>> heap;
+        DataStructures::RadixHeapPriorityQueue<int, int> radix;
+        double heapTime = Measure([&]()
+        {
+            heapSum = EventSimulation(heap, pending, events);
+        });
+        double radixTime = Measure([&]()
+        {
+            radixSum = EventSimulation(radix, pending, events);
+        });
+
+        std::cout << "Event simulation, " << events << " events: binary min-heap " << heapTime << " ms, radix heap "
+                  << radixTime << " ms, speedup " << heapTime / radixTime
+                  << (heapSum == radixSum ? "" : " (results differ!)") << std::endl;
+    }
+
+    /// \brief Runs the \p function on \p threadCount threads at once, passing the index of the thread
+    /// \param threadCount Number of the threads
+    /// \param function A function to run
+    /// \return Execution time in milliseconds, until all the threads finish
+    template<typename Function>
+    double MeasureThreads(int threadCount, Function &&function)
+    {
+        return Measure([&]()
+        {
+            DataStructures::DynamicArray<std::thread> threads(threadCount);
+            for (int i = 0; i < threadCount; ++i)
+            {
+                threads.Emplace(function, i);
+            }
+
+            for (std::thread &thread: threads)
+            {
+                thread.join();
+            }
+        });
+    }
+
+    /// \brief Runs \p perThread operations on each of \p threadCount threads, alternating Enqueue and TryDequeue
+    /// \param queue A queue safe to use concurrently
+    /// \return Execution time in milliseconds
+    template<typename Queue>
+    double MixedWorkload(Queue &queue, int threadCount, int perThread)
+    {
+        return MeasureThreads(threadCount, [&](int thread)
+        {
+            std::mt19937 generator(thread);
+            int element;
+            for (int i = 0; i < perThread; ++i)
+            {
+                if (i % 2 == 0)
+                {
+                    queue.Enqueue(i, static_cast<int>(generator() >> 1));
+                }
+                else
+                {
+                    queue.TryDequeue(element);
+                }
+            }
+        });
+    }
+
+    /// \brief Compares the concurrent heap, the lock-free skip list and the flat-combining heap with a heap guarded by
+    /// a single global lock. The queues are filled first, then every thread performs its share of the operations,
+    /// alternating Enqueue and Dequeue.
+    inline void ConcurrentQueue()
+    {
+        const int initial = 1 << 16;
+        const int operations = 1 << 20;
+
+        for (int threadCount = 1; threadCount <= 64; threadCount *= 2)
+        {
+            int perThread = operations / threadCount;
+
+            DataStructures::HeapPriorityQueue<int, int> heap;
+            std::mutex mutex;
+            DataStructures::ConcurrentHeapPriorityQueue<int, int> concurrent(initial + operations);
+            DataStructures::LockFreeSkipListPriorityQueue<int, int> lockFree;
+            DataStructures::FlatCombiningPriorityQueue<int, int> combining;
+            std::mt19937 random(7);
+            for (int i = 0; i < initial; ++i)
+            {
+                int priority = static_cast<int>(random() >> 1);
+                heap.Enqueue(i, priority);
+                concurrent.Enqueue(i, priority);
+                lockFree.Enqueue(i, priority);
+                combining.Enqueue(i, priority);
+            }
+
+            double lockedTime = MeasureThreads(threadCount, [&](int thread)
+            {
+                std::mt19937 generator(thread);
+                for (int i = 0; i < perThread; ++i)
+                {
+                    std::lock_guard<std::mutex> guard(mutex);
+                    if (i % 2 == 0)
+                    {
+                        heap.Enqueue(i, static_cast<int>(generator() >> 1));
+                    }
+                    else if (!heap.IsEmpty())
+                    {
+                        heap.Dequeue();
+                    }
+                }
+            });
+            double concurrentTime = MixedWorkload(concurrent, threadCount, perThread);
+            double lockFreeTime = MixedWorkload(lockFree, threadCount, perThread);
+            double combiningTime = MixedWorkload(combining, threadCount, perThread);
+
+            std::cout << "Concurrent queue, " << threadCount << " threads, " << operations
+                      << " operations: global lock " << lockedTime << " ms, per-node locks " << concurrentTime
+                      << " ms, lock-free skip list " << lockFreeTime << " ms, flat combining " << combiningTime << " ms"
+                      << std::endl;
+        }
+    }
+
+    /// \brief Measures the throughput and the rank error of the MultiQueue for several relaxation factors. Every
+    /// thread alternates Enqueue and Dequeue on a queue filled beforehand.
+    inline void RelaxedQueue()
+    {
+        const int threadCount = 8;
+        const int initial = 1 << 16;
+        const int operations = 1 << 20;
+        const int perThread = operations / threadCount;
+
+        for (int factor = 1; factor <= 8; factor *= 2)
+        {
+            DataStructures::MultiQueue<int, int> queue(threadCount, factor);
+            std::mt19937 random(7);
+            for (int i = 0; i < initial; ++i)
+            {
+                queue.Enqueue(i, static_cast<int>(random() >> 1));
+            }
+
+            double time = MeasureThreads(threadCount, [&](int thread)
+            {
+                std::mt19937 generator(thread);
+                int element;
+                for (int i = 0; i < perThread; ++i)
+                {
+                    if (i % 2 == 0)
+                    {
+                        queue.Enqueue(i, static_cast<int>(generator() >> 1));
+                    }
+                    else
+                    {
+                        queue.TryDequeue(element);
+                    }
+                }
+            });
+
+            DataStructures::MultiQueueStatistics statistics = queue.GetStatistics();
+            std::cout << "MultiQueue, " << threadCount << " threads, c = " << factor << ": "
+                      << operations / time << " operations/ms, mean rank error " << statistics.GetMeanRankError()
+                      << ", max rank error " << statistics.rankErrorMax << ", contentions " << statistics.contentions
+                      << std::endl;
+        }
+    }
+}
+
+#endif //PROJECT2_BENCHMARKS_H
@@ -0,0 +1,238 @@
+#ifndef PROJECT2_BLOCKINGPRIORITYQUEUE_H
+#define PROJECT2_BLOCKINGPRIORITYQUEUE_H
+
+#include "PriorityQueueLike.h"
+#include <chrono>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Represents a priority queue for producers and consumers running on different threads. Every operation
+    /// of the wrapped queue is guarded by a mutex. Dequeue waits on a condition variable while the queue is empty,
+    /// and Enqueue waits while the queue holds \p capacity items, so fast producers are slowed down to the pace of
+    /// the consumers. After Close the waiting threads are woken up, nothing can be enqueued, and the remaining items
+    /// can still be dequeued.
+    /// \tparam Q Type of the wrapped queue
+    template<PriorityQueueLike Q>
+    class BlockingPriorityQueue
+    {
+    public:
+        using ElementType = typename Q::ElementType;
+        using PriorityType = typename Q::PriorityType;
+        using CompareType = typename Q::CompareType;
+        using E = ElementType;
+        using P = PriorityType;
+
+        static const int Unbounded = std::numeric_limits<int>::max();
+
+        /// \brief Constructs a queue over the \p queue
+        /// \param capacity Maximum number of the items, greater than 0
+        /// \param queue A queue to wrap
+        explicit BlockingPriorityQueue(int capacity = Unbounded, Q queue = Q())
+            : queue(std::move(queue)), capacity(capacity), closed(false)
+        {
+            if (capacity <= 0)
+            {
+                throw std::invalid_argument("Capacity must be positive.");
+            }
+        }
+
+        BlockingPriorityQueue(const BlockingPriorityQueue &) = delete;
+
+        BlockingPriorityQueue &operator=(const BlockingPriorityQueue &) = delete;
+
+        int GetCount() const
+        {
+            std::lock_guard<std::mutex> guard(this->mutex);
+            return this->queue.GetCount();
+        }
+
+        bool IsEmpty() const
+        {
+            return this->GetCount() == 0;
+        }
+
+        /// \brief Returns the maximum number of the items
+        int GetCapacity() const
+        {
+            return this->capacity;
+        }
+
+        /// \brief Determines whether the queue has been closed
+        bool IsClosed() const
+        {
+            std::lock_guard<std::mutex> guard(this->mutex);
+            return this->closed;
+        }
+
+        /// \brief Removes all the items and wakes up the waiting producers
+        void Clear()
+        {
+            {
+                std::lock_guard<std::mutex> guard(this->mutex);
+                this->queue.Clear();
+            }
+
+            this->notFull.notify_all();
+        }
+
+        /// \brief Enqueues the \p element, waiting while the queue is full
+        /// \param element An element to enqueue
+        /// \param priority A priority of the element
+        void Enqueue(E element, P priority)
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->notFull.wait(lock, [this]()
+            {
+                return this->closed || !this->IsFull();
+            });
+
+            this->Push(lock, std::move(element), std::move(priority));
+        }
+
+        /// \brief Enqueues the \p element, if the queue is not full
+        /// \param element An element to enqueue
+        /// \param priority A priority of the element
+        /// \return \a true if the element was enqueued, \a false if the queue was full
+        bool TryEnqueue(E element, P priority)
+        {
+            return this->TryEnqueueFor(std::move(element), std::move(priority), std::chrono::seconds(0));
+        }
+
+        /// \brief Enqueues the \p element, waiting at most the \p timeout while the queue is full
+        /// \param element An element to enqueue
+        /// \param priority A priority of the element
+        /// \param timeout Maximum time of waiting
+        /// \return \a true if the element was enqueued, \a false if the queue stayed full
+        template<typename Rep, typename Period>
+        bool TryEnqueueFor(E element, P priority, const std::chrono::duration<Rep, Period> &timeout)
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            if (!this->notFull.wait_for(lock, timeout, [this]()
+            {
+                return this->closed || !this->IsFull();
+            }))
+            {
+                return false;
+            }
+
+            this->Push(lock, std::move(element), std::move(priority));
+            return true;
+        }
+
+        /// \brief Dequeues the element with the greatest priority, waiting while the queue is empty
+        /// \return The dequeued element
+        E Dequeue()
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->notEmpty.wait(lock, [this]()
+            {
+                return this->closed || !this->queue.IsEmpty();
+            });
+
+            if (this->queue.IsEmpty())
+            {
+                throw std::runtime_error("Priority queue is closed.");
+            }
+
+            return this->Pop(lock);
+        }
+
+        /// \brief Dequeues the element with the greatest priority, if the queue is not empty
+        /// \param element A reference receiving the dequeued element
+        /// \return \a true if an element was dequeued, \a false if the queue was empty
+        bool TryDequeue(E &element)
+        {
+            return this->TryDequeueFor(element, std::chrono::seconds(0));
+        }
+
+        /// \brief Dequeues the element with the greatest priority, waiting at most the \p timeout while the queue is
+        /// empty
+        /// \param element A reference receiving the dequeued element
+        /// \param timeout Maximum time of waiting
+        /// \return \a true if an element was dequeued, \a false if the queue stayed empty or was closed empty
+        template<typename Rep, typename Period>
+        bool TryDequeueFor(E &element, const std::chrono::duration<Rep, Period> &timeout)
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            if (!this->notEmpty.wait_for(lock, timeout, [this]()
+            {
+                return this->closed || !this->queue.IsEmpty();
+            }) || this->queue.IsEmpty())
+            {
+                return false;
+            }
+
+            element = this->Pop(lock);
+            return true;
+        }
+
+        /// \brief Returns a copy of the element with the greatest priority, which may be dequeued by another thread
+        /// as soon as it is read
+        E Peek() const
+        {
+            std::lock_guard<std::mutex> guard(this->mutex);
+            return this->queue.Peek();
+        }
+
+        void Modify(const E &element, P priority)
+        {
+            std::lock_guard<std::mutex> guard(this->mutex);
+            this->queue.Modify(element, std::move(priority));
+        }
+
+        /// \brief Closes the queue and wakes up all the waiting threads. Enqueue throws from now on, while Dequeue
+        /// returns the remaining items and throws once the queue is empty.
+        void Close()
+        {
+            {
+                std::lock_guard<std::mutex> guard(this->mutex);
+                this->closed = true;
+            }
+
+            this->notEmpty.notify_all();
+            this->notFull.notify_all();
+        }
+
+    private:
+        Q queue;
+        int capacity;
+        bool closed;
+        mutable std::mutex mutex;
+        std::condition_variable notEmpty;
+        std::condition_variable notFull;
+
+        bool IsFull() const
+        {
+            return this->queue.GetCount() >= this->capacity;
+        }
+
+        /// \brief Enqueues the item under the \p lock and wakes up a waiting consumer
+        void Push(std::unique_lock<std::mutex> &lock, E &&element, P &&priority)
+        {
+            if (this->closed)
+            {
+                throw std::runtime_error("Priority queue is closed.");
+            }
+
+            this->queue.Enqueue(std::move(element), std::move(priority));
+            lock.unlock();
+            this->notEmpty.notify_one();
+        }
+
+        /// \brief Dequeues an item under the \p lock and wakes up a waiting producer
+        E Pop(std::unique_lock<std::mutex> &lock)
+        {
+            E element = this->queue.Dequeue();
+            lock.unlock();
+            this->notFull.notify_one();
+            return element;
+        }
+    };
+}
+
+#endif //PROJECT2_BLOCKINGPRIORITYQUEUE_H
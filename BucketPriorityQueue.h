@@ -0,0 +1,236 @@
+#ifndef PROJECT2_BUCKETPRIORITYQUEUE_H
+#define PROJECT2_BUCKETPRIORITYQUEUE_H
+
+#include "PriorityQueueBase.h"
+#include "DynamicArray.h"
+#include "LinkedList.h"
+#include "QueueItem.h"
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Represents a bucket queue for priorities in the range from 0 to \p PriorityCount - 1. Every priority has
+    /// its own list of items, and a bitmap of the non-empty lists is scanned with std::countl_zero, so Enqueue,
+    /// Dequeue, Peek and modifying or removing an item through its handle take O(1). The element with the greatest
+    /// priority is dequeued first, items with equal priorities are dequeued in the order of insertion. The lists
+    /// share a single node pool.
+    /// \tparam E Type of the elements
+    /// \tparam P Integral type of the priorities
+    /// \tparam PriorityCount Number of the distinct priorities
+    template<typename E = int, std::integral P = int, int PriorityCount = 256>
+    class BucketPriorityQueue : public PriorityQueueBase<BucketPriorityQueue<E, P, PriorityCount>, E, P, std::less<P>>
+    {
+        static_assert(PriorityCount > 0, "PriorityCount must be positive");
+
+    public:
+        using Handle = LinkedListNode<QueueItem<E, P>> *;
+
+        BucketPriorityQueue()
+            : PriorityQueueBase<BucketPriorityQueue<E, P, PriorityCount>, E, P, std::less<P>>(std::less<P>()),
+              pool(std::make_unique<typename LinkedList<QueueItem<E, P>>::PoolType>()), buckets(PriorityCount),
+              nonEmpty(), count(0)
+        {
+            for (int i = 0; i < PriorityCount; ++i)
+            {
+                this->buckets.Emplace(this->pool.get());
+            }
+        }
+
+        /// \brief Constructs a queue containing the \p items
+        /// \param items A range of items to enqueue
+        template<QueueItemRange<E, P> R>
+        explicit BucketPriorityQueue(R &&items) : BucketPriorityQueue()
+        {
+            this->EnqueueRange(std::forward<R>(items));
+        }
+
+        BucketPriorityQueue(const BucketPriorityQueue &) = delete;
+
+        /// \brief Constructs a queue taking over the items of the \p queue. The \p queue is left empty and may only
+        /// be cleared or destroyed.
+        /// \param queue A queue to move the items from
+        BucketPriorityQueue(BucketPriorityQueue &&queue) noexcept
+            : PriorityQueueBase<BucketPriorityQueue<E, P, PriorityCount>, E, P, std::less<P>>(std::less<P>()),
+              pool(std::move(queue.pool)), buckets(std::move(queue.buckets)), count(queue.count)
+        {
+            for (int word = 0; word < WordCount; ++word)
+            {
+                this->nonEmpty[word] = queue.nonEmpty[word];
+                queue.nonEmpty[word] = 0;
+            }
+
+            queue.count = 0;
+        }
+
+        BucketPriorityQueue &operator=(const BucketPriorityQueue &) = delete;
+
+        int GetCount() const
+        {
+            return this->count;
+        }
+
+        void Clear()
+        {
+            for (int word = 0; word < WordCount; ++word)
+            {
+                while (this->nonEmpty[word] != 0)
+                {
+                    int bit = std::countr_zero(this->nonEmpty[word]);
+                    this->buckets[word * 64 + bit].Clear();
+                    this->nonEmpty[word] &= this->nonEmpty[word] - 1;
+                }
+            }
+
+            this->count = 0;
+        }
+
+        /// \brief Enqueues the \p element at the end of the list of its \p priority
+        /// \param element An element to enqueue
+        /// \param priority A priority of the element
+        /// \return A handle to the enqueued item, which stays valid until the item is dequeued or removed
+        Handle Enqueue(E element, P priority)
+        {
+            CheckPriority(priority);
+
+            auto &bucket = this->buckets[static_cast<int>(priority)];
+            bucket.AddLast({std::move(element), priority});
+            this->MarkNonEmpty(static_cast<int>(priority));
+            ++this->count;
+            return bucket.GetLast();
+        }
+
+        E Dequeue()
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            int index = this->GetTopBucket();
+            auto &bucket = this->buckets[index];
+            E element = std::move(bucket.GetFirst()->GetValue().element);
+            bucket.RemoveFirst();
+            this->UpdateBucket(index);
+            --this->count;
+            return element;
+        }
+
+        const E &Peek() const
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            return this->buckets[this->GetTopBucket()].GetFirst()->GetValue().element;
+        }
+
+        void Modify(const E &element, P priority)
+        {
+            for (int index = 0; index < PriorityCount; ++index)
+            {
+                auto node = this->buckets[index].GetFirst();
+                for (int i = 0; i < this->buckets[index].GetCount(); ++i)
+                {
+                    if (node->GetValue().element == element)
+                    {
+                        this->Modify(node, std::move(priority));
+                        return;
+                    }
+
+                    node = node->GetNext();
+                }
+            }
+
+            throw std::runtime_error("Element not found in priority queue.");
+        }
+
+        /// \brief Moves the item to the end of the list of the new \p priority in O(1). The handle stays valid.
+        /// \param handle A handle returned by Enqueue
+        /// \param priority A new priority of the item
+        void Modify(Handle handle, P priority)
+        {
+            this->CheckHandle(handle);
+            CheckPriority(priority);
+
+            int from = static_cast<int>(handle->GetValue().priority);
+            int to = static_cast<int>(priority);
+            handle->GetValue().priority = priority;
+            this->buckets[to].MoveLast(handle, this->buckets[from]);
+            this->UpdateBucket(from);
+            this->MarkNonEmpty(to);
+        }
+
+        /// \brief Removes the item from the queue in O(1)
+        /// \param handle A handle returned by Enqueue, which becomes invalid
+        void Remove(Handle handle)
+        {
+            this->CheckHandle(handle);
+
+            int index = static_cast<int>(handle->GetValue().priority);
+            this->buckets[index].RemoveNode(handle);
+            this->UpdateBucket(index);
+            --this->count;
+        }
+
+    private:
+        static constexpr int WordCount = (PriorityCount + 63) / 64;
+
+        std::unique_ptr<typename LinkedList<QueueItem<E, P>>::PoolType> pool;
+        DynamicArray<LinkedList<QueueItem<E, P>>> buckets;
+        std::uint64_t nonEmpty[WordCount];
+        int count;
+
+        static void CheckPriority(const P &priority)
+        {
+            if (priority < 0 || priority >= PriorityCount)
+            {
+                throw std::invalid_argument("Priority is outside the range of priority queue.");
+            }
+        }
+
+        void CheckHandle(Handle handle) const
+        {
+            if (handle == nullptr || handle->GetValue().priority < 0 || handle->GetValue().priority >= PriorityCount ||
+                handle->GetList() != &this->buckets[static_cast<int>(handle->GetValue().priority)])
+            {
+                throw std::runtime_error("Element not found in priority queue.");
+            }
+        }
+
+        void MarkNonEmpty(int index)
+        {
+            this->nonEmpty[index / 64] |= std::uint64_t(1) << (index % 64);
+        }
+
+        /// \brief Clears the bit of the bucket at the \p index, if the bucket became empty
+        void UpdateBucket(int index)
+        {
+            if (this->buckets[index].IsEmpty())
+            {
+                this->nonEmpty[index / 64] &= ~(std::uint64_t(1) << (index % 64));
+            }
+        }
+
+        /// \brief Returns the index of the non-empty bucket with the greatest priority
+        int GetTopBucket() const
+        {
+            int word = WordCount - 1;
+            while (this->nonEmpty[word] == 0)
+            {
+                --word;
+            }
+
+            return word * 64 + 63 - std::countl_zero(this->nonEmpty[word]);
+        }
+    };
+
+} // DataStructures
+
+#endif //PROJECT2_BUCKETPRIORITYQUEUE_H
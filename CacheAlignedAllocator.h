@@ -0,0 +1,51 @@
+#ifndef PROJECT2_CACHEALIGNEDALLOCATOR_H
+#define PROJECT2_CACHEALIGNEDALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+
+namespace DataStructures
+{
+    const std::size_t CacheLineSize = 64;
+
+    /// \brief Represents an allocator, which aligns every allocated block to the cache line
+    /// \tparam T Type of the allocated elements
+    /// \tparam Alignment Alignment of the allocated blocks in bytes
+    template<typename T, std::size_t Alignment = CacheLineSize>
+    class CacheAlignedAllocator
+    {
+    public:
+        using value_type = T;
+
+        template<typename U>
+        struct rebind
+        {
+            using other = CacheAlignedAllocator<U, Alignment>;
+        };
+
+        CacheAlignedAllocator() = default;
+
+        template<typename U>
+        CacheAlignedAllocator(const CacheAlignedAllocator<U, Alignment> &)
+        {
+        }
+
+        T *allocate(std::size_t count)
+        {
+            return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+        }
+
+        void deallocate(T *pointer, std::size_t)
+        {
+            ::operator delete(pointer, std::align_val_t(Alignment));
+        }
+
+        template<typename U>
+        bool operator==(const CacheAlignedAllocator<U, Alignment> &) const
+        {
+            return true;
+        }
+    };
+}
+
+#endif //PROJECT2_CACHEALIGNEDALLOCATOR_H
@@ -0,0 +1,281 @@
+#ifndef PROJECT2_CONCURRENTHEAPPRIORITYQUEUE_H
+#define PROJECT2_CONCURRENTHEAPPRIORITYQUEUE_H
+
+#include "PriorityQueueBase.h"
+#include "CacheAlignedAllocator.h"
+#include "QueueItem.h"
+#include "SpinLock.h"
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Represents a fixed-capacity binary heap, which can be used by many threads at once (Hunt, Michael,
+    /// Parthasarathy and Scott, 1996). Every node has its own lock, and a short global lock guards only the size.
+    /// Enqueue places the item at the bottom and sifts it up, locking a parent and a child at a time, while Dequeue
+    /// moves the bottom item to the root and sifts it down. Nodes are always locked from the top to the bottom.
+    /// Every node is tagged as empty, available or being inserted by a given Enqueue, so an inserting thread can
+    /// follow its item when a concurrent Dequeue moves it. Consecutive positions at the bottom are taken in
+    /// the bit-reversed order, so consecutive operations descend into different subtrees.
+    /// \tparam E Type of the elements
+    /// \tparam P Type of the priorities
+    /// \tparam Compare Comparator of the priorities, the element with the greatest priority is dequeued first
+    template<typename E = int, typename P = int, typename Compare = std::less<P>>
+    class ConcurrentHeapPriorityQueue
+        : public PriorityQueueBase<ConcurrentHeapPriorityQueue<E, P, Compare>, E, P, Compare>
+    {
+    public:
+        /// \brief Constructs an empty queue able to hold \p capacity items
+        /// \param capacity Maximum number of the items, greater than 0
+        /// \param compare Comparator of the priorities
+        explicit ConcurrentHeapPriorityQueue(int capacity, const Compare &compare = Compare())
+            : PriorityQueueBase<ConcurrentHeapPriorityQueue<E, P, Compare>, E, P, Compare>(compare),
+              capacity(capacity), lastIndex(0), count(0), nextTag(Available + 1)
+        {
+            if (capacity <= 0)
+            {
+                throw std::invalid_argument("Capacity must be positive.");
+            }
+
+            // Pozycje na ostatnim poziomie są odwrócone bitowo, więc ostatni poziom musi być pełny
+            this->lastIndex = static_cast<int>(std::bit_ceil(static_cast<unsigned>(capacity) + 1)) - 1;
+            this->nodes = std::make_unique<Node[]>(this->lastIndex + 1);
+        }
+
+        /// \brief Returns the number of the items, which may change as soon as it is read
+        int GetCount() const
+        {
+            std::lock_guard<SpinLock> guard(this->countLock);
+            return this->count;
+        }
+
+        /// \brief Returns the maximum number of the items
+        int GetCapacity() const
+        {
+            return this->capacity;
+        }
+
+        /// \brief Enqueues the \p element with the given \p priority. Safe to call concurrently.
+        /// \param element An element to enqueue
+        /// \param priority A priority of the element
+        void Enqueue(E element, P priority)
+        {
+            this->countLock.lock();
+            if (this->count == this->capacity)
+            {
+                this->countLock.unlock();
+                throw std::runtime_error("Priority queue is full.");
+            }
+
+            int index = GetPosition(++this->count);
+            std::uint64_t tag = this->nextTag++;
+            this->nodes[index].lock.lock();
+            this->countLock.unlock();
+
+            this->nodes[index].item = {std::move(element), std::move(priority)};
+            this->nodes[index].tag = tag;
+            this->nodes[index].lock.unlock();
+
+            while (index > 1)
+            {
+                int parent = index / 2;
+                this->nodes[parent].lock.lock();
+                this->nodes[index].lock.lock();
+
+                int current = index;
+                if (this->nodes[parent].tag == Available && this->nodes[index].tag == tag)
+                {
+                    if (this->HasHigherPriority(this->nodes[index].item.priority, this->nodes[parent].item.priority))
+                    {
+                        this->Swap(index, parent);
+                        index = parent;
+                    }
+                    else
+                    {
+                        this->nodes[index].tag = Available;
+                        index = 0;
+                    }
+                }
+                else if (this->nodes[parent].tag == Empty)
+                {
+                    // Element został przeniesiony do korzenia przez Dequeue
+                    index = 0;
+                }
+                else if (this->nodes[index].tag != tag)
+                {
+                    // Element został przesunięty w górę przez Dequeue
+                    index = parent;
+                }
+
+                this->nodes[current].lock.unlock();
+                this->nodes[parent].lock.unlock();
+
+                if (index == current)
+                {
+                    // Rodzic jest wstawiany przez inny wątek, który musi najpierw skończyć
+                    std::this_thread::yield();
+                }
+            }
+
+            if (index == 1)
+            {
+                std::lock_guard<SpinLock> guard(this->nodes[1].lock);
+                if (this->nodes[1].tag == tag)
+                {
+                    this->nodes[1].tag = Available;
+                }
+            }
+        }
+
+        /// \brief Dequeues the element with the greatest priority. Safe to call concurrently.
+        /// \param element A reference receiving the dequeued element
+        /// \return \a true if an element was dequeued, \a false if the queue was empty
+        bool TryDequeue(E &element)
+        {
+            this->countLock.lock();
+            if (this->count == 0)
+            {
+                this->countLock.unlock();
+                return false;
+            }
+
+            int bottom = GetPosition(this->count--);
+            this->nodes[bottom].lock.lock();
+            this->countLock.unlock();
+
+            QueueItem<E, P> item = std::move(this->nodes[bottom].item);
+            this->nodes[bottom].tag = Empty;
+            this->nodes[bottom].lock.unlock();
+
+            this->nodes[1].lock.lock();
+            if (this->nodes[1].tag == Empty)
+            {
+                // Usunięty element był jedynym elementem kopca
+                this->nodes[1].lock.unlock();
+                element = std::move(item.element);
+                return true;
+            }
+
+            element = std::move(this->nodes[1].item.element);
+            this->nodes[1].item = std::move(item);
+            this->nodes[1].tag = Available;
+
+            int index = 1;
+            while (2 * index <= this->lastIndex)
+            {
+                int left = 2 * index;
+                int right = left + 1;
+                bool hasRight = right <= this->lastIndex;
+
+                this->nodes[left].lock.lock();
+                if (hasRight)
+                {
+                    this->nodes[right].lock.lock();
+                }
+
+                if (this->nodes[left].tag == Empty)
+                {
+                    this->nodes[left].lock.unlock();
+                    if (hasRight)
+                    {
+                        this->nodes[right].lock.unlock();
+                    }
+
+                    break;
+                }
+
+                int child = left;
+                if (hasRight && this->nodes[right].tag != Empty &&
+                    this->HasHigherPriority(this->nodes[right].item.priority, this->nodes[left].item.priority))
+                {
+                    child = right;
+                    this->nodes[left].lock.unlock();
+                }
+                else if (hasRight)
+                {
+                    this->nodes[right].lock.unlock();
+                }
+
+                if (!this->HasHigherPriority(this->nodes[child].item.priority, this->nodes[index].item.priority))
+                {
+                    this->nodes[child].lock.unlock();
+                    break;
+                }
+
+                this->Swap(child, index);
+                this->nodes[index].lock.unlock();
+                index = child;
+            }
+
+            this->nodes[index].lock.unlock();
+            return true;
+        }
+
+        /// \brief Dequeues the element with the greatest priority. Safe to call concurrently.
+        /// \return The dequeued element
+        E Dequeue()
+        {
+            E element;
+            if (!this->TryDequeue(element))
+            {
+                throw std::exception();
+            }
+
+            return element;
+        }
+
+    private:
+        static const std::uint64_t Empty = 0;
+        static const std::uint64_t Available = 1;
+
+        struct alignas(CacheLineSize) Node
+        {
+            SpinLock lock;
+            std::uint64_t tag = Empty;
+            QueueItem<E, P> item;
+        };
+
+        std::unique_ptr<Node[]> nodes;
+        int capacity;
+        int lastIndex;
+        int count;
+        std::uint64_t nextTag;
+        mutable SpinLock countLock;
+
+        /// \brief Returns the position of the \p n-th item (counted from 1), which is \p n with the bits below
+        /// the highest one reversed
+        static int GetPosition(int n)
+        {
+            int level = 1;
+            while (2 * level <= n)
+            {
+                level *= 2;
+            }
+
+            int position = level;
+            for (int bit = level / 2, reversed = 1; bit > 0; bit /= 2, reversed *= 2)
+            {
+                if (n & bit)
+                {
+                    position |= reversed;
+                }
+            }
+
+            return position;
+        }
+
+        void Swap(int first, int second)
+        {
+            std::swap(this->nodes[first].item, this->nodes[second].item);
+            std::swap(this->nodes[first].tag, this->nodes[second].tag);
+        }
+    };
+
+} // DataStructures
+
+#endif //PROJECT2_CONCURRENTHEAPPRIORITYQUEUE_H
@@ -1,34 +1,52 @@
 #ifndef PROJEKT1_DYNAMICARRAY_H
 #define PROJEKT1_DYNAMICARRAY_H
 
+#include <cstring>
+#include <initializer_list>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace DataStructures
 {
     const int DefaultCapacity = 4;
-    const int CapacityMultiplier = 2;
+    const double DefaultGrowthFactor = 2.0;
 
     /// \brief Represents a dynamic array
     /// \tparam T Type parameter
-    template<typename T>
+    /// \tparam Allocator Allocator of the memory for the elements
+    template<typename T, typename Allocator = std::allocator<T>>
     class DynamicArray
     {
+        using AllocatorTraits = std::allocator_traits<Allocator>;
+        static_assert(std::is_same_v<typename AllocatorTraits::value_type, T>, "Allocator must allocate T");
+
     public:
         /// \brief Constructs an empty array with the capacity of 4 elements
-        DynamicArray() : DynamicArray<T>(DefaultCapacity)
+        DynamicArray() : DynamicArray(DefaultCapacity)
+        {
+        }
+
+        /// \brief Constructs an empty array with the capacity of 4 elements using the \p allocator
+        /// \param allocator Allocator of the memory for the elements
+        explicit DynamicArray(const Allocator &allocator) : DynamicArray(DefaultCapacity, allocator)
         {
         }
 
         /// \brief Constructs an empty array with the capacity of \p capacity elements.
         /// \param capacity Capacity of the array
-        explicit DynamicArray(int capacity) : capacity(capacity), length(0)
+        /// \param allocator Allocator of the memory for the elements
+        explicit DynamicArray(int capacity, const Allocator &allocator = Allocator())
+            : items(nullptr), length(0), capacity(0), growthFactor(DefaultGrowthFactor), allocator(allocator)
         {
-            this->items = new T[this->capacity];
+            this->Reserve(capacity);
         }
 
         /// \brief Constructs an array containing the elements from the \p initializerList
         /// \param initializerList An \a initializer_list containing elements for the array
-        DynamicArray(const std::initializer_list<T> &initializerList) : DynamicArray(initializerList.size())
+        DynamicArray(const std::initializer_list<T> &initializerList)
+            : DynamicArray(static_cast<int>(initializerList.size()))
         {
             for (const auto &item: initializerList)
             {
@@ -38,16 +56,29 @@ namespace DataStructures
 
         /// \brief Constructs an \p array deep copy
         /// \param array An array to copy elements from
-        DynamicArray(const DynamicArray<T> &array) : capacity(array.capacity), length(array.length)
+        DynamicArray(const DynamicArray &array)
+            : DynamicArray(array.capacity, AllocatorTraits::select_on_container_copy_construction(array.allocator))
         {
-            this->items = new T[this->capacity];
-            Copy(array.items, 0, this->items, 0, array.length);
+            this->growthFactor = array.growthFactor;
+            this->CopyConstruct(array.items, array.length);
+        }
+
+        /// \brief Constructs an array taking over the elements of the \p array, which is left empty
+        /// \param array An array to move elements from
+        DynamicArray(DynamicArray &&array) noexcept
+            : items(array.items), length(array.length), capacity(array.capacity), growthFactor(array.growthFactor),
+              allocator(std::move(array.allocator))
+        {
+            array.items = nullptr;
+            array.length = 0;
+            array.capacity = 0;
         }
 
         /// \brief Destructs the array freeing up the memory used for storing its elements
         ~DynamicArray()
         {
-            delete[] this->items;
+            this->Clear();
+            this->Deallocate(this->items, this->capacity);
         }
 
         /// \brief Returns the current number of elements in the array
@@ -57,10 +88,36 @@ namespace DataStructures
             return this->length;
         }
 
+        /// \brief Returns the number of elements the array can hold without reallocating
+        /// \return Capacity of the array
+        int GetCapacity() const
+        {
+            return this->capacity;
+        }
+
+        /// \brief Returns the factor, by which the capacity is multiplied when the array is full
+        /// \return Growth factor of the array
+        double GetGrowthFactor() const
+        {
+            return this->growthFactor;
+        }
+
+        /// \brief Sets the factor, by which the capacity is multiplied when the array is full
+        /// \param factor Growth factor greater than 1
+        void SetGrowthFactor(double factor)
+        {
+            if (!(factor > 1.0))
+            {
+                throw std::invalid_argument("Growth factor must be greater than 1");
+            }
+
+            this->growthFactor = factor;
+        }
+
         /// \brief Accesses the element at given \p index position in the array
         /// \param index An zero-based index of an array item
         /// \return An element at the given \p index position
-        T operator[](int index) const
+        const T &operator[](int index) const
         {
             CheckIndex(index);
             return this->items[index];
@@ -78,69 +135,125 @@ namespace DataStructures
         /// \brief Performs a deep copying of the \p array and assigns its contents to the current object
         /// \param array An array to copy from
         /// \return A reference to the edited object
-        DynamicArray<T> &operator=(const DynamicArray<T> &array)
+        DynamicArray &operator=(const DynamicArray &array)
         {
             if (&array == this)
             {
                 return *this;
             }
 
-            if (array.capacity != this->capacity)
+            this->Clear();
+            if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value)
             {
-                delete[] this->items;
-                this->capacity = array.capacity;
-                this->items = new T[this->capacity];
+                if (this->allocator != array.allocator)
+                {
+                    this->Deallocate(this->items, this->capacity);
+                    this->items = nullptr;
+                    this->capacity = 0;
+                }
+
+                this->allocator = array.allocator;
             }
 
-            Copy(array.items, 0, this->items, 0, array.length);
-            this->length = array.length;
+            this->growthFactor = array.growthFactor;
+            this->Reserve(array.length);
+            this->CopyConstruct(array.items, array.length);
             return *this;
         }
 
-        /// \brief Performs a deep copying of the \p initializerList and assigns its contents to the current object
-        /// \param array An \a initializer_list to copy from
+        /// \brief Takes over the elements of the \p array, which is left empty
+        /// \param array An array to move from
         /// \return A reference to the edited object
-        DynamicArray<T> &operator=(const std::initializer_list<T> &initializerList)
+        DynamicArray &operator=(DynamicArray &&array) noexcept(AllocatorTraits::is_always_equal::value ||
+                                                               AllocatorTraits::propagate_on_container_move_assignment::value)
         {
-            if (this->capacity < initializerList.size())
+            if (&array == this)
             {
-                delete[] this->items;
-                if (initializerList.size() % 4 == 0)
-                {
-                    this->capacity = initializerList.size();
-                }
-                else
+                return *this;
+            }
+
+            this->Clear();
+            if constexpr (!AllocatorTraits::propagate_on_container_move_assignment::value &&
+                          !AllocatorTraits::is_always_equal::value)
+            {
+                if (this->allocator != array.allocator)
                 {
-                    this->capacity = DefaultCapacity;
-                    while (this->capacity < initializerList.size())
-                    {
-                        this->capacity *= CapacityMultiplier;
-                    }
+                    // Pamięci nie można przejąć, więc przenosimy elementy pojedynczo
+                    this->growthFactor = array.growthFactor;
+                    this->Reserve(array.length);
+                    this->Relocate(array.items, this->items, array.length);
+                    this->length = array.length;
+                    array.length = 0;
+                    return *this;
                 }
+            }
 
-                this->items = new T[this->capacity];
+            this->Deallocate(this->items, this->capacity);
+            if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value)
+            {
+                this->allocator = std::move(array.allocator);
             }
 
-            int i = 0;
+            this->items = array.items;
+            this->length = array.length;
+            this->capacity = array.capacity;
+            this->growthFactor = array.growthFactor;
+            array.items = nullptr;
+            array.length = 0;
+            array.capacity = 0;
+            return *this;
+        }
+
+        /// \brief Performs a deep copying of the \p initializerList and assigns its contents to the current object
+        /// \param array An \a initializer_list to copy from
+        /// \return A reference to the edited object
+        DynamicArray &operator=(const std::initializer_list<T> &initializerList)
+        {
+            this->Clear();
+            this->Reserve(static_cast<int>(initializerList.size()));
             for (const auto &item: initializerList)
             {
-                this->items[i++] = item;
+                this->Add(item);
             }
 
-            this->length = initializerList.size();
             return *this;
         }
 
         /// \brief Adds a new \p item to the array
         /// \param item An item to add
-        void Add(T item)
+        void Add(const T &item)
         {
-            if (this->length == this->capacity)
+            this->Emplace(item);
+        }
+
+        /// \brief Adds a new \p item to the array, moving it into the array
+        /// \param item An item to add
+        void Add(T &&item)
+        {
+            this->Emplace(std::move(item));
+        }
+
+        /// \brief Adds a new item constructed in place from the \p arguments to the array
+        /// \param arguments Arguments of the item constructor
+        /// \return A reference to the added item
+        template<typename... Arguments>
+        T &Emplace(Arguments &&... arguments)
+        {
+            if (this->length < this->capacity)
             {
-                IncreaseCapacity();
+                AllocatorTraits::construct(this->allocator, this->items + this->length, std::forward<Arguments>(arguments)...);
+                return this->items[this->length++];
             }
 
-            this->items[this->length++] = item;
+            // Argumenty mogą wskazywać na elementy tej tablicy, więc nowy element tworzymy przed zwolnieniem starej
+            int newCapacity = this->GetGrownCapacity();
+            T *newItems = this->Allocate(newCapacity);
+            AllocatorTraits::construct(this->allocator, newItems + this->length, std::forward<Arguments>(arguments)...);
+            this->Relocate(this->items, newItems, this->length);
+            this->Deallocate(this->items, this->capacity);
+            this->items = newItems;
+            this->capacity = newCapacity;
+            return this->items[this->length++];
         }
 
         /// \brief Inserts a new \p item to the given \p index of the array
@@ -151,22 +264,29 @@ namespace DataStructures
             CheckIndex(index);
             if (this->length == this->capacity)
             {
-                this->capacity *= CapacityMultiplier;
-                T *newItems = new T[this->capacity];
-                if (index != 0)
-                {
-                    Copy(this->items, 0, newItems, 0, index);
-                }
-
-                newItems[index] = item;
-                Copy(this->items, index, newItems, index + 1, this->length - index);
-                delete[] this->items;
+                int newCapacity = this->GetGrownCapacity();
+                T *newItems = this->Allocate(newCapacity);
+                AllocatorTraits::construct(this->allocator, newItems + index, std::move(item));
+                this->Relocate(this->items, newItems, index);
+                this->Relocate(this->items + index, newItems + index + 1, this->length - index);
+                this->Deallocate(this->items, this->capacity);
                 this->items = newItems;
+                this->capacity = newCapacity;
+            }
+            else if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                std::memmove(this->items + index + 1, this->items + index, (this->length - index) * sizeof(T));
+                AllocatorTraits::construct(this->allocator, this->items + index, std::move(item));
             }
             else
             {
-                Copy(this->items, index, index + 1, this->length - index);
-                this->items[index] = item;
+                AllocatorTraits::construct(this->allocator, this->items + this->length, std::move(this->items[this->length - 1]));
+                for (int i = this->length - 1; i > index; i--)
+                {
+                    this->items[i] = std::move(this->items[i - 1]);
+                }
+
+                this->items[index] = std::move(item);
             }
 
             this->length++;
@@ -175,7 +295,7 @@ namespace DataStructures
         /// \brief Verifies if the \p item is present in the array
         /// \param item An item to search for
         /// \return \a true if the item was found, \a false otherwise
-        bool Contains(T item) const
+        bool Contains(const T &item) const
         {
             for (int i = 0; i < this->length; i++)
             {
@@ -191,7 +311,7 @@ namespace DataStructures
         /// \brief Searches the array for the first occurrence of the given \p item
         /// \param item An item to search for
         /// \return A zero-based index of the first occurrence of \p item in the array if found, -1 otherwise
-        int IndexOf(T item) const
+        int IndexOf(const T &item) const
         {
             for (int i = 0; i < this->length; i++)
             {
@@ -207,7 +327,7 @@ namespace DataStructures
         /// \brief Searches the array for the last occurrence of the given \p item
         /// \param item An item to search for
         /// \return A zero-based index of the last occurrence of \p item in the array if found, -1 otherwise
-        int LastIndexOf(T item) const
+        int LastIndexOf(const T &item) const
         {
             for (int i = this->length - 1; i >= 0; i--)
             {
@@ -223,6 +343,7 @@ namespace DataStructures
         /// \brief Removes all the items from the array
         void Clear()
         {
+            this->Destroy(this->items, this->length);
             this->length = 0;
         }
 
@@ -236,8 +357,20 @@ namespace DataStructures
                 return RemoveLast();
             }
 
-            Copy(this->items, index + 1, index, this->length - index - 1);
-            --this->length;
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                std::memmove(this->items + index, this->items + index + 1, (this->length - index - 1) * sizeof(T));
+                --this->length;
+            }
+            else
+            {
+                for (int i = index; i < this->length - 1; i++)
+                {
+                    this->items[i] = std::move(this->items[i + 1]);
+                }
+
+                RemoveLast();
+            }
         }
 
         /// \brief Removes the first item of the array.
@@ -250,63 +383,152 @@ namespace DataStructures
         void RemoveLast()
         {
             this->length--;
+            AllocatorTraits::destroy(this->allocator, this->items + this->length);
+        }
+
+        /// \brief Ensures that the array can hold at least \p capacity elements without reallocating
+        /// \param capacity Minimal capacity of the array
+        void Reserve(int capacity)
+        {
+            if (capacity > this->capacity)
+            {
+                this->Reallocate(capacity);
+            }
+        }
+
+        /// \brief Reduces the capacity of the array to its length
+        void ShrinkToFit()
+        {
+            if (this->length < this->capacity)
+            {
+                this->Reallocate(this->length);
+            }
+        }
+
+        /// \brief Returns a pointer to the first element of the array
+        /// \return A pointer to the first element
+        T *begin()
+        {
+            return this->items;
+        }
+
+        /// \brief Returns a pointer past the last element of the array
+        /// \return A pointer past the last element
+        T *end()
+        {
+            return this->items + this->length;
+        }
+
+        /// \brief Returns a pointer to the first element of the array
+        /// \return A pointer to the first element
+        const T *begin() const
+        {
+            return this->items;
+        }
+
+        /// \brief Returns a pointer past the last element of the array
+        /// \return A pointer past the last element
+        const T *end() const
+        {
+            return this->items + this->length;
         }
 
     private:
         T *items;
         int length;
         int capacity;
+        double growthFactor;
+        [[no_unique_address]] Allocator allocator;
+
+        int GetGrownCapacity() const
+        {
+            if (this->capacity == 0)
+            {
+                return DefaultCapacity;
+            }
+
+            int grown = static_cast<int>(this->capacity * this->growthFactor);
+            return grown > this->capacity ? grown : this->capacity + 1;
+        }
 
-        void IncreaseCapacity()
+        void Reallocate(int newCapacity)
         {
-            this->capacity *= CapacityMultiplier; // Mnożymy pojemność przez mnożnik (równy 2)
-            T *newItems = new T[this->capacity]; // Allokujemy pamięć dla nowej tablicy wewnętrznej
-            Copy(this->items, 0, newItems, 0, this->length); // Kopiujemy elementy starej tablicy do nowej
-            delete[] this->items; // Zwalniamy pamięć używają przez starą tablicę
-            this->items = newItems; // Przepisujemy wskaźnik nowej tablicy do pola obiektu
+            T *newItems = this->Allocate(newCapacity); // Allokujemy pamięć bez konstruowania elementów
+            this->Relocate(this->items, newItems, this->length); // Przenosimy elementy starej tablicy do nowej
+            this->Deallocate(this->items, this->capacity); // Zwalniamy pamięć używaną przez starą tablicę
+            this->items = newItems;
+            this->capacity = newCapacity;
         }
 
-        void CheckIndex(int index) const
+        T *Allocate(int count)
         {
-            if (index < 0 || index >= this->length)
+            return count > 0 ? AllocatorTraits::allocate(this->allocator, count) : nullptr;
+        }
+
+        void Deallocate(T *array, int count)
+        {
+            if (array != nullptr)
             {
-                throw std::invalid_argument("Index is outside of the array");
+                AllocatorTraits::deallocate(this->allocator, array, count);
             }
         }
 
-        static void Copy(T *array, int sourceIndex, int destinationIndex, int count)
+        void Destroy(T *array, int count)
         {
-            if (sourceIndex == destinationIndex)
+            if constexpr (!std::is_trivially_destructible_v<T>)
             {
-                return;
+                for (int i = 0; i < count; i++)
+                {
+                    AllocatorTraits::destroy(this->allocator, array + i);
+                }
             }
+        }
 
-            if (sourceIndex < destinationIndex)
+        void CopyConstruct(const T *sourceArray, int count)
+        {
+            if constexpr (std::is_trivially_copyable_v<T>)
             {
-                for (int i = count - 1; i >= 0; i--)
+                if (count > 0)
                 {
-                    array[destinationIndex + i] = array[sourceIndex + i];
+                    std::memcpy(this->items, sourceArray, count * sizeof(T));
                 }
             }
             else
             {
                 for (int i = 0; i < count; i++)
                 {
-                    array[destinationIndex + i] = array[sourceIndex + i];
+                    AllocatorTraits::construct(this->allocator, this->items + i, sourceArray[i]);
                 }
             }
+
+            this->length = count;
         }
 
-        static void Copy(T *sourceArray, int sourceIndex, T *destinationArray, int destinationIndex, int count)
+        /// \brief Moves \p count elements to the uninitialized \p destinationArray and destroys the sources
+        void Relocate(T *sourceArray, T *destinationArray, int count)
         {
-            if (sourceArray == destinationArray)
+            if constexpr (std::is_trivially_copyable_v<T>)
             {
-                return Copy(sourceArray, sourceIndex, destinationIndex, count);
+                if (count > 0)
+                {
+                    std::memcpy(destinationArray, sourceArray, count * sizeof(T));
+                }
             }
+            else
+            {
+                for (int i = 0; i < count; i++)
+                {
+                    AllocatorTraits::construct(this->allocator, destinationArray + i, std::move_if_noexcept(sourceArray[i]));
+                    AllocatorTraits::destroy(this->allocator, sourceArray + i);
+                }
+            }
+        }
 
-            for (int i = 0; i < count; i++)
+        void CheckIndex(int index) const
+        {
+            if (index < 0 || index >= this->length)
             {
-                destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i];
+                throw std::invalid_argument("Index is outside of the array");
             }
         }
     };
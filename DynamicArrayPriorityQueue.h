@@ -1,38 +1,88 @@
 #ifndef PROJECT2_DYNAMICARRAYPRIORITYQUEUE_H
 #define PROJECT2_DYNAMICARRAYPRIORITYQUEUE_H
 
-#include "IPriorityQueue.h"
+#include "PriorityQueueBase.h"
 #include "DynamicArray.h"
+#include "PriorityKernels.h"
 #include "QueueItem.h"
 #include "stdexcept"
+#include <utility>
 
 namespace DataStructures
 {
 
-    class DynamicArrayPriorityQueue : public IPriorityQueue
+    /// \brief Represents a priority queue on an unsorted dynamic array. The priorities are kept apart from the
+    /// elements, so searching for the greatest priority does not load the elements and 32-bit priorities are searched
+    /// with SIMD instructions. The index of the greatest priority is cached until the next Dequeue or Modify.
+    /// \tparam E Type of the elements
+    /// \tparam P Type of the priorities
+    /// \tparam Compare Comparator of the priorities, the element with the greatest priority is dequeued first
+    template<typename E = int, typename P = int, typename Compare = std::less<P>>
+    class DynamicArrayPriorityQueue : public PriorityQueueBase<DynamicArrayPriorityQueue<E, P, Compare>, E, P, Compare>
     {
     public:
-        int GetCount() const
+        explicit DynamicArrayPriorityQueue(const Compare &compare = Compare())
+            : PriorityQueueBase<DynamicArrayPriorityQueue<E, P, Compare>, E, P, Compare>(compare)
+        {
+        }
+
+        /// \brief Constructs a queue containing the \p items
+        /// \param items A range of items to enqueue
+        /// \param compare Comparator of the priorities
+        template<QueueItemRange<E, P> R>
+        explicit DynamicArrayPriorityQueue(R &&items, const Compare &compare = Compare())
+            : DynamicArrayPriorityQueue(compare)
         {
-            return this->elements.GetLength();
+            this->EnqueueRange(std::forward<R>(items));
         }
 
-        bool IsEmpty() const
+        int GetCount() const
         {
-            return this->GetCount() == 0;
+            return this->priorities.GetLength();
         }
 
         void Clear()
         {
+            this->priorities.Clear();
             this->elements.Clear();
+            this->maxIndex = -1;
         }
 
-        void Enqueue(int element, int priority)
+        void Enqueue(E element, P priority)
         {
-            this->elements.Add({element,priority});
+            if (this->IsEmpty() ||
+                (this->maxIndex != -1 && this->HasHigherPriority(priority, this->priorities[this->maxIndex])))
+            {
+                this->maxIndex = this->GetCount();
+            }
+
+            this->priorities.Add(std::move(priority));
+            this->elements.Add(std::move(element));
         }
 
-        int Dequeue()
+        /// \brief Enqueues all the \p items, reserving the memory once
+        /// \param items A range of items to enqueue
+        template<QueueItemRange<E, P> R>
+        void EnqueueRange(R &&items)
+        {
+            if constexpr (std::ranges::sized_range<R>)
+            {
+                int length = this->GetCount() + static_cast<int>(std::ranges::size(items));
+                this->priorities.Reserve(length);
+                this->elements.Reserve(length);
+            }
+
+            for (auto &&item: items)
+            {
+                QueueItem<E, P> queueItem = ForwardItem<R>(item);
+                this->priorities.Add(std::move(queueItem.priority));
+                this->elements.Add(std::move(queueItem.element));
+            }
+
+            this->maxIndex = -1;
+        }
+
+        E Dequeue()
         {
             if(this->IsEmpty())
             {
@@ -40,12 +90,14 @@ namespace DataStructures
             }
 
             int index = this->GetMaxIndex();
-            int element = this->elements[index].element;
+            E element = std::move(this->elements[index]);
+            this->priorities.RemoveAt(index);
             this->elements.RemoveAt(index);
+            this->maxIndex = -1;
             return element;
         }
 
-        int Peek() const
+        const E &Peek() const
         {
             if(this->IsEmpty())
             {
@@ -53,41 +105,35 @@ namespace DataStructures
             }
 
             int index = this->GetMaxIndex();
-            return this->elements[index].element;
+            return this->elements[index];
         }
 
-        void Modify(int element, int priority)
+        void Modify(const E &element, P priority)
         {
             for(int i = 0; i < this->elements.GetLength(); i++)
             {
-                if(this->elements[i].element == element)
+                if(this->elements[i] == element)
                 {
-                    this->elements[i].priority = priority;
+                    this->priorities[i] = std::move(priority);
+                    this->maxIndex = -1;
                     break;
                 }
             }
         }
 
     private:
-        DynamicArray<QueueItem<int, int>> elements;
+        DynamicArray<P> priorities;
+        DynamicArray<E> elements;
+        mutable int maxIndex = -1;
 
         int GetMaxIndex() const
         {
-            if(this->IsEmpty())
+            if(this->maxIndex == -1 && !this->IsEmpty())
             {
-                return -1;
-            }
-
-            int maxIndex = 0;
-            for(int i = 1; i < this->GetCount(); i++)
-            {
-                if(this->elements[i].priority > this->elements[maxIndex].priority)
-                {
-                    maxIndex = i;
-                }
+                this->maxIndex = FindBest(this->priorities.begin(), this->GetCount(), this->compare);
             }
 
-            return maxIndex;
+            return this->maxIndex;
         }
     };
 
@@ -0,0 +1,184 @@
+#ifndef PROJECT2_EPOCHRECLAIMER_H
+#define PROJECT2_EPOCHRECLAIMER_H
+
+#include "DynamicArray.h"
+#include "ThreadSlots.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace DataStructures
+{
+    /// \brief Represents an epoch-based reclaimer of the nodes of lock-free structures (Fraser, 2004). A thread
+    /// reads shared nodes only while it holds a Guard, which announces the global epoch it has observed. An unlinked
+    /// node is retired with the global epoch of that moment and is deleted when the global epoch is greater by 2,
+    /// because then every thread, which could still read it, has released its guard. The global epoch advances when
+    /// all the guarded threads have observed it.
+    /// Every thread using the reclaimer takes one of MaxThreads slots on its first guard and keeps it until the
+    /// reclaimer is destroyed.
+    /// \tparam T Type of the nodes
+    /// \tparam Deleter Function object deleting a node
+    template<typename T, typename Deleter = std::default_delete<T>>
+    class EpochReclaimer
+    {
+        struct Slot
+        {
+            /// \brief Observed epoch shifted left by one, with the lowest bit set while the thread holds a guard
+            std::atomic<std::uint64_t> state = 0;
+            int depth = 0;
+            int retiredCount = 0;
+            std::uint64_t epochs[3] = {};
+            DynamicArray<T *> retired[3];
+        };
+
+    public:
+        static const int MaxThreads = 128;
+        static const int AdvanceInterval = 64;
+
+        /// \brief Represents the protection of the calling thread, the nodes read under a guard are not deleted
+        /// until it is destroyed. Guards may be nested.
+        class Guard
+        {
+        public:
+            Guard(const Guard &) = delete;
+
+            Guard &operator=(const Guard &) = delete;
+
+            ~Guard()
+            {
+                this->reclaimer.Leave(this->slot);
+            }
+
+        private:
+            friend class EpochReclaimer;
+
+            EpochReclaimer &reclaimer;
+            Slot &slot;
+
+            Guard(EpochReclaimer &reclaimer, Slot &slot) : reclaimer(reclaimer), slot(slot)
+            {
+                this->reclaimer.Enter(this->slot);
+            }
+        };
+
+        explicit EpochReclaimer(const Deleter &deleter = Deleter())
+            : epoch(0), deleter(deleter)
+        {
+        }
+
+        EpochReclaimer(const EpochReclaimer &) = delete;
+
+        EpochReclaimer &operator=(const EpochReclaimer &) = delete;
+
+        /// \brief Destructs the reclaimer deleting all the retired nodes. No thread may hold a guard.
+        ~EpochReclaimer()
+        {
+            for (int i = 0; i < this->slots.GetUsedCount(); ++i)
+            {
+                for (DynamicArray<T *> &retired: this->slots[i].retired)
+                {
+                    this->Delete(retired);
+                }
+            }
+        }
+
+        /// \brief Protects the nodes read by the calling thread until the returned guard is destroyed
+        /// \return A guard of the calling thread
+        Guard Protect()
+        {
+            return Guard(*this, this->slots.GetSlot());
+        }
+
+        /// \brief Deletes the \p node, when no thread can read it anymore. The node must have been unlinked, and
+        /// the calling thread must hold a guard.
+        /// \param node A node to delete
+        void Retire(T *node)
+        {
+            Slot &slot = this->slots.GetSlot();
+            std::uint64_t epoch = this->epoch.load();
+            int index = static_cast<int>(epoch % 3);
+            if (slot.epochs[index] != epoch)
+            {
+                // Węzły z epoki o 3 wcześniejszej nie są już przez nikogo czytane
+                this->Delete(slot.retired[index]);
+                slot.epochs[index] = epoch;
+            }
+
+            slot.retired[index].Add(node);
+            if (++slot.retiredCount % AdvanceInterval == 0 && this->TryAdvance(epoch))
+            {
+                this->Collect(slot, epoch + 1);
+            }
+        }
+
+    private:
+        ThreadSlots<Slot, MaxThreads> slots;
+        std::atomic<std::uint64_t> epoch;
+        Deleter deleter;
+
+        void Enter(Slot &slot)
+        {
+            if (slot.depth++ > 0)
+            {
+                return;
+            }
+
+            std::uint64_t epoch;
+            do
+            {
+                epoch = this->epoch.load();
+                slot.state.store(epoch << 1 | 1);
+            } while (this->epoch.load() != epoch);
+
+            this->Collect(slot, epoch);
+        }
+
+        void Leave(Slot &slot)
+        {
+            if (--slot.depth == 0)
+            {
+                slot.state.store(0);
+            }
+        }
+
+        /// \brief Advances the global epoch from the \p epoch, if every guarded thread has observed it
+        /// \return \a true if the epoch was advanced by the calling thread, \a false otherwise
+        bool TryAdvance(std::uint64_t epoch)
+        {
+            for (int i = 0; i < this->slots.GetUsedCount(); ++i)
+            {
+                std::uint64_t state = this->slots[i].state.load();
+                if ((state & 1) != 0 && state >> 1 != epoch)
+                {
+                    return false;
+                }
+            }
+
+            return this->epoch.compare_exchange_strong(epoch, epoch + 1);
+        }
+
+        /// \brief Deletes the nodes of the \p slot retired at least 2 epochs before the \p epoch
+        void Collect(Slot &slot, std::uint64_t epoch)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                if (slot.epochs[i] + 2 <= epoch)
+                {
+                    this->Delete(slot.retired[i]);
+                }
+            }
+        }
+
+        void Delete(DynamicArray<T *> &retired)
+        {
+            for (T *node: retired)
+            {
+                this->deleter(node);
+            }
+
+            retired.Clear();
+        }
+    };
+}
+
+#endif //PROJECT2_EPOCHRECLAIMER_H
@@ -0,0 +1,243 @@
+#ifndef PROJECT2_FLATCOMBININGPRIORITYQUEUE_H
+#define PROJECT2_FLATCOMBININGPRIORITYQUEUE_H
+
+#include "PriorityQueueBase.h"
+#include "DynamicArray.h"
+#include "HeapPriorityQueue.h"
+#include "QueueItem.h"
+#include "SpinLock.h"
+#include "ThreadSlots.h"
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Represents a HeapPriorityQueue, which can be used by many threads at once through flat combining
+    /// (Hendler, Incze, Shavit and Tzafrir, 2010). A thread publishes its Enqueue or Dequeue in its own slot, and
+    /// the thread, which acquires the combiner lock, applies the requests of all the threads in passes. The
+    /// enqueued items of a pass are added with a single EnqueueRange, which rebuilds the heap bottom-up when the
+    /// batch is larger than the heap, and then the dequeues are served. Only the combiner touches the heap, so its
+    /// arrays stay in a single cache, and the other threads spin on their own slots.
+    /// \tparam E Type of the elements
+    /// \tparam P Type of the priorities
+    /// \tparam Compare Comparator of the priorities, the element with the greatest priority is dequeued first
+    template<typename E = int, typename P = int, typename Compare = std::less<P>>
+    class FlatCombiningPriorityQueue
+        : public PriorityQueueBase<FlatCombiningPriorityQueue<E, P, Compare>, E, P, Compare>
+    {
+        enum class RequestState
+        {
+            Idle,
+            Enqueue,
+            Dequeue,
+            Done
+        };
+
+        struct Request
+        {
+            std::atomic<RequestState> state = RequestState::Idle;
+            bool succeeded = false;
+            QueueItem<E, P> item;
+        };
+
+    public:
+        static const int MaxThreads = 128;
+        static const int CombinePasses = 4;
+        static const int SpinCount = 64;
+
+        explicit FlatCombiningPriorityQueue(const Compare &compare = Compare())
+            : PriorityQueueBase<FlatCombiningPriorityQueue<E, P, Compare>, E, P, Compare>(compare), heap(compare),
+              count(0)
+        {
+        }
+
+        /// \brief Returns the number of the items, which may change as soon as it is read
+        int GetCount() const
+        {
+            return this->count.load(std::memory_order_relaxed);
+        }
+
+        /// \brief Enqueues the \p element with the given \p priority. Safe to call concurrently.
+        /// \param element An element to enqueue
+        /// \param priority A priority of the element
+        void Enqueue(E element, P priority)
+        {
+            Request &request = this->requests.GetSlot();
+            request.item = {std::move(element), std::move(priority)};
+            this->Execute(request, RequestState::Enqueue);
+        }
+
+        /// \brief Dequeues the element with the greatest priority. Safe to call concurrently.
+        /// \param element A reference receiving the dequeued element
+        /// \return \a true if an element was dequeued, \a false if the queue was empty
+        bool TryDequeue(E &element)
+        {
+            Request &request = this->requests.GetSlot();
+            this->Execute(request, RequestState::Dequeue);
+            if (request.succeeded)
+            {
+                element = std::move(request.item.element);
+            }
+
+            return request.succeeded;
+        }
+
+        /// \brief Dequeues the element with the greatest priority. Safe to call concurrently.
+        /// \return The dequeued element
+        E Dequeue()
+        {
+            E element;
+            if (!this->TryDequeue(element))
+            {
+                throw std::exception();
+            }
+
+            return element;
+        }
+
+    private:
+        ThreadSlots<Request, MaxThreads> requests;
+        SpinLock combinerLock;
+        HeapPriorityQueue<E, P, Compare> heap;
+        DynamicArray<QueueItem<E, P>> batch;
+        DynamicArray<int> batchSlots;
+        std::atomic<int> count;
+
+        /// \brief Publishes the \p request and waits until it is applied, combining the requests of all the threads
+        /// whenever the combiner lock is free. If combining throws, the requests not applied stay published for
+        /// the next combiner, and the calling thread withdraws its own request and rethrows, unless the request
+        /// has already been applied.
+        void Execute(Request &request, RequestState operation)
+        {
+            request.state.store(operation, std::memory_order_release);
+
+            int spins = 0;
+            while (true)
+            {
+                std::unique_lock<SpinLock> lock(this->combinerLock, std::try_to_lock);
+                if (lock.owns_lock())
+                {
+                    try
+                    {
+                        for (int pass = 0; pass < CombinePasses && this->Combine(); ++pass)
+                        {
+                        }
+                    }
+                    catch (...)
+                    {
+                        if (request.state.load(std::memory_order_relaxed) != RequestState::Done)
+                        {
+                            request.state.store(RequestState::Idle, std::memory_order_relaxed);
+                            throw;
+                        }
+                    }
+                }
+
+                if (request.state.load(std::memory_order_acquire) == RequestState::Done)
+                {
+                    request.state.store(RequestState::Idle, std::memory_order_relaxed);
+                    return;
+                }
+
+                if (++spins >= SpinCount)
+                {
+                    // Kombinator mógł zostać wywłaszczony, więc oddajemy mu procesor
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        /// \brief Applies all the published requests, first the enqueues as a single batch and then the dequeues.
+        /// The batch is moved into the heap, and the enqueue requests are marked as done only after it has been
+        /// added. If adding throws before the heap takes the batch, the items are moved back to their requests,
+        /// which keeps them intact unless moving an element throws.
+        /// \return \a true if any request was applied, \a false otherwise
+        bool Combine()
+        {
+            int slotCount = this->requests.GetUsedCount();
+            bool applied = false;
+
+            // Rezerwacja przed przeniesieniem pierwszego elementu, więc Add już nie rzuca wyjątku
+            this->batch.Reserve(slotCount);
+            this->batchSlots.Reserve(slotCount);
+            for (int i = 0; i < slotCount; ++i)
+            {
+                Request &request = this->requests[i];
+                if (request.state.load(std::memory_order_acquire) == RequestState::Enqueue)
+                {
+                    this->batch.Add(std::move(request.item));
+                    this->batchSlots.Add(i);
+                }
+            }
+
+            if (this->batch.GetLength() > 0)
+            {
+                int oldCount = this->heap.GetCount();
+                try
+                {
+                    this->heap.EnqueueRange(std::move(this->batch));
+                }
+                catch (...)
+                {
+                    if (this->heap.GetCount() == oldCount)
+                    {
+                        for (int i = 0; i < this->batch.GetLength(); ++i)
+                        {
+                            this->requests[this->batchSlots[i]].item = std::move(this->batch[i]);
+                        }
+                    }
+                    else
+                    {
+                        // Kopiec przejął partię, a wyjątek rzuciło dopiero przywracanie jego porządku
+                        this->CompleteBatch();
+                    }
+
+                    this->batch.Clear();
+                    this->batchSlots.Clear();
+                    this->count.store(this->heap.GetCount(), std::memory_order_relaxed);
+                    throw;
+                }
+
+                this->CompleteBatch();
+                this->batch.Clear();
+                this->batchSlots.Clear();
+                applied = true;
+            }
+
+            for (int i = 0; i < slotCount; ++i)
+            {
+                Request &request = this->requests[i];
+                if (request.state.load(std::memory_order_acquire) == RequestState::Dequeue)
+                {
+                    request.succeeded = !this->heap.IsEmpty();
+                    if (request.succeeded)
+                    {
+                        request.item.element = this->heap.Dequeue();
+                    }
+
+                    request.state.store(RequestState::Done, std::memory_order_release);
+                    applied = true;
+                }
+            }
+
+            this->count.store(this->heap.GetCount(), std::memory_order_relaxed);
+            return applied;
+        }
+
+        /// \brief Marks the enqueue requests of the batch as done
+        void CompleteBatch()
+        {
+            for (int slot: this->batchSlots)
+            {
+                this->requests[slot].state.store(RequestState::Done, std::memory_order_release);
+            }
+        }
+    };
+
+} // DataStructures
+
+#endif //PROJECT2_FLATCOMBININGPRIORITYQUEUE_H
@@ -1,67 +1,199 @@
 #ifndef PROJECT2_HEAPPRIORITYQUEUE_H
 #define PROJECT2_HEAPPRIORITYQUEUE_H
 
-#include "IPriorityQueue.h"
+#include "PriorityQueueBase.h"
+#include "CacheAlignedAllocator.h"
+#include "DynamicArray.h"
+#include "PriorityKernels.h"
+#include "QueueItem.h"
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace DataStructures
 {
-    class HeapPriorityQueue : public IPriorityQueue
+    /// \brief Represents a d-ary heap priority queue. The priorities are kept apart from the elements, so the children
+    /// of 8-ary and 16-ary heaps of 32-bit priorities are compared with SIMD instructions. A heap of a greater arity
+    /// than 2 starts at the index \p Arity - 1 of the priority array, so the children of every node occupy a block of
+    /// \p Arity priorities starting at a multiple of \p Arity, and a 4-ary or 8-ary heap of small priorities visits
+    /// a single cache line per level. The first \p Arity - 1 priorities are default-constructed padding, while the
+    /// elements are stored without padding. A binary heap starts at the index 0. While sifting, only the priorities
+    /// are moved level by level; the elements are moved once, after their final positions are known.
+    /// \tparam E Type of the elements
+    /// \tparam P Type of the priorities, default constructible unless \p Arity is 2
+    /// \tparam Compare Comparator of the priorities, the element with the greatest priority is dequeued first
+    /// \tparam Arity Number of children of every node (2, 4, 8 or 16)
+    /// \tparam Allocator Allocator of the items, rebound to the priorities and the elements. By default both arrays
+    /// start at a cache line boundary, so the blocks of children never straddle two lines.
+    template<typename E = int, typename P = int, typename Compare = std::less<P>, int Arity = 2,
+            typename Allocator = CacheAlignedAllocator<QueueItem<E, P>>>
+    class HeapPriorityQueue
+        : public PriorityQueueBase<HeapPriorityQueue<E, P, Compare, Arity, Allocator>, E, P, Compare>
     {
+        static_assert(Arity == 2 || Arity == 4 || Arity == 8 || Arity == 16, "Arity must be 2, 4, 8 or 16");
+        static_assert(Arity == 2 || std::is_default_constructible_v<P>,
+                      "P must be default constructible to pad the priorities of a heap of arity greater than 2");
+
     public:
-        int GetCount() const
+        explicit HeapPriorityQueue(const Compare &compare = Compare(), const Allocator &allocator = Allocator())
+            : PriorityQueueBase<HeapPriorityQueue<E, P, Compare, Arity, Allocator>, E, P, Compare>(compare),
+              priorities(PriorityAllocator(allocator)), elements(ElementAllocator(allocator))
         {
-            return this->elements.GetLength();
+            this->AddPadding();
         }
 
-        bool IsEmpty() const
+        /// \brief Constructs a heap containing the \p items in O(n)
+        /// \param items A range of items to enqueue
+        /// \param compare Comparator of the priorities
+        /// \param allocator Allocator of the items
+        template<QueueItemRange<E, P> R>
+        explicit HeapPriorityQueue(R &&items, const Compare &compare = Compare(),
+                                   const Allocator &allocator = Allocator())
+            : HeapPriorityQueue(compare, allocator)
         {
-            return this->elements.GetLength() == 0;
+            this->EnqueueRange(std::forward<R>(items));
+        }
+
+        int GetCount() const
+        {
+            return this->priorities.GetLength() - Root;
         }
 
         void Clear()
         {
+            this->priorities.Clear();
             this->elements.Clear();
+            this->AddPadding();
         }
 
-        void Enqueue(int element, int priority)
+        void Enqueue(E element, P priority)
         {
-            this->elements.Add({element, priority});
-            this->HeapifyUp(this->GetCount() - 1);
+            int index = this->priorities.GetLength();
+            int hole = this->FindSlotUp(index, priority);
+            if (hole == index)
+            {
+                this->priorities.Add(std::move(priority));
+                this->elements.Add(std::move(element));
+                return;
+            }
+
+            int parent = Parent(index);
+            this->priorities.Add(std::move(this->priorities[parent]));
+            this->elements.Add(std::move(this->ElementAt(parent)));
+            this->MoveAncestorsDown(parent, hole);
+            this->priorities[hole] = std::move(priority);
+            this->ElementAt(hole) = std::move(element);
         }
 
-        int Dequeue()
+        /// \brief Enqueues all the \p items, reserving the memory once. If the batch is larger than the heap,
+        /// the heap is rebuilt bottom-up in O(n), otherwise every new item is sifted up. If adding an item throws,
+        /// the items added so far are removed and the heap is left unchanged.
+        /// \param items A range of items to enqueue
+        template<QueueItemRange<E, P> R>
+        void EnqueueRange(R &&items)
+        {
+            int oldCount = this->GetCount();
+            if constexpr (std::ranges::sized_range<R>)
+            {
+                int added = static_cast<int>(std::ranges::size(items));
+                this->priorities.Reserve(this->priorities.GetLength() + added);
+                this->elements.Reserve(this->elements.GetLength() + added);
+            }
+
+            try
+            {
+                for (auto &&item: items)
+                {
+                    QueueItem<E, P> queueItem = ForwardItem<R>(item);
+                    this->priorities.Add(std::move(queueItem.priority));
+                    this->elements.Add(std::move(queueItem.element));
+                }
+            }
+            catch (...)
+            {
+                while (this->priorities.GetLength() > Root + oldCount)
+                {
+                    this->priorities.RemoveLast();
+                }
+
+                while (this->elements.GetLength() > oldCount)
+                {
+                    this->elements.RemoveLast();
+                }
+
+                throw;
+            }
+
+            int count = this->GetCount();
+            if (count - oldCount > oldCount)
+            {
+                for (int i = count > 1 ? Parent(Root + count - 1) : -1; i >= Root; --i)
+                {
+                    this->HeapifyDown(i);
+                }
+            }
+            else
+            {
+                for (int i = Root + oldCount; i < Root + count; ++i)
+                {
+                    this->HeapifyUp(i);
+                }
+            }
+        }
+
+        E Dequeue()
         {
             if (this->IsEmpty())
             {
                 throw std::exception();
             }
 
-            int element = this->elements[0].element;
-            this->elements[0] = this->elements[this->GetCount() - 1];
+            int last = this->priorities.GetLength() - 1;
+            E element = std::move(this->ElementAt(Root));
+            P lastPriority = std::move(this->priorities[last]);
+            E lastElement = std::move(this->ElementAt(last));
+            this->priorities.RemoveLast();
             this->elements.RemoveLast();
-            this->HeapifyDown(0);
+
+            if (last != Root)
+            {
+                this->SiftDown(Root, std::move(lastPriority), std::move(lastElement));
+            }
+
             return element;
         }
 
-        int Peek() const
+        const E &Peek() const
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            return this->ElementAt(Root);
+        }
+
+        /// \brief Returns the priority of the element, which would be dequeued next
+        const P &PeekPriority() const
         {
             if (this->IsEmpty())
             {
                 throw std::exception();
             }
 
-            return this->elements[0].element;
+            return this->priorities[Root];
         }
 
-        void Modify(int element, int priority)
+        void Modify(const E &element, P priority)
         {
             int index = -1;
 
-            for (int i = 0; i < this->GetCount(); ++i)
+            for (int i = 0; i < this->elements.GetLength(); ++i)
             {
-                if (this->elements[i].element == element)
+                if (this->elements[i] == element)
                 {
-                    index = i;
+                    index = i + Root;
                     break;
                 }
             }
@@ -71,68 +203,146 @@ namespace DataStructures
                 throw std::runtime_error("Element not found in priority queue.");
             }
 
-            int oldPriority = this->elements[index].priority;
-            this->elements[index].priority = priority;
+            bool increased = this->HasHigherPriority(priority, this->priorities[index]);
+            this->priorities[index] = std::move(priority);
 
-            if (priority < oldPriority)
+            if (increased)
             {
                 HeapifyUp(index);
             }
-            else if (priority > oldPriority)
+            else
             {
                 HeapifyDown(index);
             }
         }
 
     private:
-        DynamicArray<QueueItem<int, int>> elements;
+        static constexpr int Root = Arity == 2 ? 0 : Arity - 1;
 
-        void HeapifyUp(int index)
+        using PriorityAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<P>;
+        using ElementAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<E>;
+
+        DynamicArray<P, PriorityAllocator> priorities;
+        DynamicArray<E, ElementAllocator> elements;
+
+        static int Parent(int index)
+        {
+            return (index - Root - 1) / Arity + Root;
+        }
+
+        static int FirstChild(int index)
+        {
+            return Arity * (index - Root) + Root + 1;
+        }
+
+        /// \brief Returns the element of the item at the \p index of the priority array
+        E &ElementAt(int index)
+        {
+            return this->elements[index - Root];
+        }
+
+        const E &ElementAt(int index) const
+        {
+            return this->elements[index - Root];
+        }
+
+        void AddPadding()
         {
-            while (index > 0)
+            for (int i = 0; i < Root; ++i)
             {
-                int parent = (index - 1) / 2;
-                if (this->elements[index].priority > this->elements[parent].priority)
-                {
-                    std::swap(this->elements[index], this->elements[parent]);
-                    index = parent;
-                }
-                else
+                this->priorities.Add(P());
+            }
+        }
+
+        /// \brief Finds the slot on the path from \p index to the root, where an item with the \p priority belongs
+        int FindSlotUp(int index, const P &priority) const
+        {
+            while (index > Root)
+            {
+                int parent = Parent(index);
+                if (!this->HasHigherPriority(priority, this->priorities[parent]))
                 {
                     break;
                 }
+
+                index = parent;
+            }
+
+            return index;
+        }
+
+        /// \brief Moves every item on the path from the \p hole (exclusive) to \p index one level down
+        void MoveAncestorsDown(int index, int hole)
+        {
+            while (index != hole)
+            {
+                int parent = Parent(index);
+                this->priorities[index] = std::move(this->priorities[parent]);
+                this->ElementAt(index) = std::move(this->ElementAt(parent));
+                index = parent;
             }
         }
 
+        void HeapifyUp(int index)
+        {
+            int hole = this->FindSlotUp(index, this->priorities[index]);
+            if (hole == index)
+            {
+                return;
+            }
+
+            P priority = std::move(this->priorities[index]);
+            E element = std::move(this->ElementAt(index));
+            this->MoveAncestorsDown(index, hole);
+            this->priorities[hole] = std::move(priority);
+            this->ElementAt(hole) = std::move(element);
+        }
+
         void HeapifyDown(int index)
         {
-            int count = this->GetCount();
+            P priority = std::move(this->priorities[index]);
+            E element = std::move(this->ElementAt(index));
+            this->SiftDown(index, std::move(priority), std::move(element));
+        }
+
+        /// \brief Places an item in the \p hole or below it. The priorities of the greater children are moved up
+        /// while descending, and the elements are moved along the recorded path afterwards.
+        void SiftDown(int hole, P priority, E &&element)
+        {
+            int length = this->priorities.GetLength();
+            int path[32];
+            int depth = 0;
+            int start = hole;
+
             while (true)
             {
-                int smallest = index;
-                int left = 2 * index + 1;
-                int right = 2 * index + 2;
-
-                if (left < count && this->elements[left].priority > this->elements[smallest].priority)
+                int first = FirstChild(hole);
+                if (first >= length)
                 {
-                    smallest = left;
+                    break;
                 }
 
-                if (right < count && this->elements[right].priority > this->elements[smallest].priority)
-                {
-                    smallest = right;
-                }
+                int count = first + Arity < length ? Arity : length - first;
+                int largest = first + SelectBest<Arity>(this->priorities.begin() + first, count, this->compare);
 
-                if (smallest != index)
-                {
-                    std::swap(this->elements[index], this->elements[smallest]);
-                    index = smallest;
-                }
-                else
+                if (!this->HasHigherPriority(this->priorities[largest], priority))
                 {
                     break;
                 }
+
+                this->priorities[hole] = std::move(this->priorities[largest]);
+                path[depth++] = largest;
+                hole = largest;
+            }
+
+            this->priorities[hole] = std::move(priority);
+            for (int i = 0; i < depth; ++i)
+            {
+                this->ElementAt(start) = std::move(this->ElementAt(path[i]));
+                start = path[i];
             }
+
+            this->ElementAt(hole) = std::move(element);
         }
     };
 
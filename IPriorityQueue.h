@@ -1,9 +1,16 @@
 #ifndef PROJECT2_IPRIORITYQUEUE_H
 #define PROJECT2_IPRIORITYQUEUE_H
 
+#include <functional>
+
 namespace DataStructures
 {
 
+    /// \brief Represents a priority queue
+    /// \tparam E Type of the elements
+    /// \tparam P Type of the priorities
+    /// \tparam Compare Comparator of the priorities, the element with the greatest priority is dequeued first
+    template<typename E = int, typename P = int, typename Compare = std::less<P>>
     class IPriorityQueue
     {
     public:
@@ -11,10 +18,10 @@ namespace DataStructures
         virtual int GetCount() const = 0;
         virtual bool IsEmpty() const = 0;
         virtual void Clear() = 0;
-        virtual void Enqueue(int element, int priority) = 0;
-        virtual int Dequeue() = 0;
-        virtual int Peek() const = 0;
-        virtual void Modify(int element, int priority) = 0;
+        virtual void Enqueue(E element, P priority) = 0;
+        virtual E Dequeue() = 0;
+        virtual const E &Peek() const = 0;
+        virtual void Modify(const E &element, P priority) = 0;
     };
 
 } // DataStructures
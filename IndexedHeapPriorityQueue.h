@@ -0,0 +1,208 @@
+#ifndef PROJECT2_INDEXEDHEAPPRIORITYQUEUE_H
+#define PROJECT2_INDEXEDHEAPPRIORITYQUEUE_H
+
+#include "PriorityQueueBase.h"
+#include "DynamicArray.h"
+#include "QueueItem.h"
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Represents a binary heap priority queue, which keeps track of the position of every element,
+    /// allowing to modify or remove an element in O(log n). Elements of the queue must be unique.
+    /// \tparam E Type of the elements, which must be hashable
+    /// \tparam P Type of the priorities
+    /// \tparam Compare Comparator of the priorities, the element with the greatest priority is dequeued first
+    template<typename E = int, typename P = int, typename Compare = std::less<P>>
+    class IndexedHeapPriorityQueue : public PriorityQueueBase<IndexedHeapPriorityQueue<E, P, Compare>, E, P, Compare>
+    {
+    public:
+        explicit IndexedHeapPriorityQueue(const Compare &compare = Compare())
+            : PriorityQueueBase<IndexedHeapPriorityQueue<E, P, Compare>, E, P, Compare>(compare)
+        {
+        }
+
+        int GetCount() const
+        {
+            return this->elements.GetLength();
+        }
+
+        void Clear()
+        {
+            this->elements.Clear();
+            this->positions.clear();
+        }
+
+        void Enqueue(E element, P priority)
+        {
+            if (this->Contains(element))
+            {
+                throw std::invalid_argument("Element is already present in priority queue.");
+            }
+
+            this->positions[element] = this->GetCount();
+            this->elements.Add({std::move(element), std::move(priority)});
+            this->HeapifyUp(this->GetCount() - 1);
+        }
+
+        E Dequeue()
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            return this->RemoveAtIndex(0);
+        }
+
+        const E &Peek() const
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            return this->elements[0].element;
+        }
+
+        void Modify(const E &element, P priority)
+        {
+            int index = this->GetIndex(element);
+            bool increased = this->HasHigherPriority(priority, this->elements[index].priority);
+            this->elements[index].priority = std::move(priority);
+
+            if (increased)
+            {
+                this->HeapifyUp(index);
+            }
+            else
+            {
+                this->HeapifyDown(index);
+            }
+        }
+
+        /// \brief Removes the given \p element from the queue
+        /// \param element An element to remove
+        void Remove(const E &element)
+        {
+            this->RemoveAtIndex(this->GetIndex(element));
+        }
+
+        /// \brief Determines whether the \p element is present in the queue
+        /// \param element An element to search for
+        /// \return \a true if the \p element was found, \a false otherwise
+        bool Contains(const E &element) const
+        {
+            return this->positions.find(element) != this->positions.end();
+        }
+
+    private:
+        DynamicArray<QueueItem<E, P>> elements;
+        std::unordered_map<E, int> positions;
+
+        int GetIndex(const E &element) const
+        {
+            auto position = this->positions.find(element);
+            if (position == this->positions.end())
+            {
+                throw std::runtime_error("Element not found in priority queue.");
+            }
+
+            return position->second;
+        }
+
+        E RemoveAtIndex(int index)
+        {
+            int last = this->GetCount() - 1;
+            this->positions.erase(this->elements[index].element);
+            E element = std::move(this->elements[index].element);
+
+            if (index == last)
+            {
+                this->elements.RemoveLast();
+                return element;
+            }
+
+            bool increased = this->HasHigherPriority(this->elements[last].priority, this->elements[index].priority);
+            this->Place(std::move(this->elements[last]), index);
+            this->elements.RemoveLast();
+
+            if (increased)
+            {
+                this->HeapifyUp(index);
+            }
+            else
+            {
+                this->HeapifyDown(index);
+            }
+
+            return element;
+        }
+
+        void Place(QueueItem<E, P> &&item, int index)
+        {
+            this->positions[item.element] = index;
+            this->elements[index] = std::move(item);
+        }
+
+        void Swap(int first, int second)
+        {
+            QueueItem<E, P> item = std::move(this->elements[first]);
+            this->Place(std::move(this->elements[second]), first);
+            this->Place(std::move(item), second);
+        }
+
+        void HeapifyUp(int index)
+        {
+            while (index > 0)
+            {
+                int parent = (index - 1) / 2;
+                if (this->HasHigherPriority(this->elements[index].priority, this->elements[parent].priority))
+                {
+                    this->Swap(index, parent);
+                    index = parent;
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+
+        void HeapifyDown(int index)
+        {
+            int count = this->GetCount();
+            while (true)
+            {
+                int largest = index;
+                int left = 2 * index + 1;
+                int right = 2 * index + 2;
+
+                if (left < count && this->HasHigherPriority(this->elements[left].priority, this->elements[largest].priority))
+                {
+                    largest = left;
+                }
+
+                if (right < count && this->HasHigherPriority(this->elements[right].priority, this->elements[largest].priority))
+                {
+                    largest = right;
+                }
+
+                if (largest != index)
+                {
+                    this->Swap(index, largest);
+                    index = largest;
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+    };
+
+} // DataStructures
+
+#endif //PROJECT2_INDEXEDHEAPPRIORITYQUEUE_H
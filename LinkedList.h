@@ -1,35 +1,54 @@
 #ifndef PROJEKT1_LINKEDLIST_H
 #define PROJEKT1_LINKEDLIST_H
 
+#include "DynamicArray.h"
 #include "LinkedListNode.h"
+#include "NodePool.h"
+#include <stdexcept>
+#include <type_traits>
 
 namespace DataStructures
 {
-    /// \brief Represents a circular doubly-linked list
+    /// \brief Represents a circular doubly-linked list. The nodes are allocated from a pool, which is owned by the
+    /// list or shared with other lists.
     /// \tparam T Type parameter
     template<typename T>
     class LinkedList
     {
     public:
-        /// \brief Constructs an empty list
-        LinkedList() : head(nullptr), count(0)
+        using PoolType = NodePool<LinkedListNode<T>>;
+
+        /// \brief Constructs an empty list allocating its nodes from its own pool
+        LinkedList() : head(nullptr), count(0), pool(&this->ownPool)
+        {
+        }
+
+        /// \brief Constructs an empty list allocating its nodes from the shared \p pool
+        /// \param pool A pool, which must outlive the list
+        explicit LinkedList(PoolType *pool) : head(nullptr), count(0), pool(pool)
         {
         }
 
-        /// \brief Copy constructor
+        /// \brief Copy constructor. The copy shares the pool of the \p list, unless the \p list owns its pool.
         /// \param list List to copy from
-        LinkedList(const LinkedList &list) : head(nullptr), count(0)
+        LinkedList(const LinkedList &list)
+            : head(nullptr), count(0), pool(list.OwnsPool() ? &this->ownPool : list.pool)
         {
-            LinkedListNode<T> *current = list.head;
-            if (current != nullptr)
+            this->AddAll(list);
+        }
+
+        /// \brief Copy assignment operator. The list keeps its pool and allocates the copied items from it.
+        /// \param list List to copy from
+        /// \return Reference to this list
+        LinkedList &operator=(const LinkedList &list)
+        {
+            if (this != &list)
             {
-                do
-                {
-                    this->AddLast(current->GetValue());
-                    current = current->GetNext();
-                }
-                while (current != list.head);
+                this->Clear();
+                this->AddAll(list);
             }
+
+            return *this;
         }
 
         /// \brief Destructs the list freeing up the memory used to store its items
@@ -125,7 +144,7 @@ namespace DataStructures
         /// \param value An item to add
         void AddFirst(T value)
         {
-            auto node = new LinkedListNode(this, value);
+            auto node = this->pool->Allocate(this, std::move(value));
             if (this->IsEmpty())
             {
                 this->head = node;
@@ -144,7 +163,7 @@ namespace DataStructures
         /// \param value An item to add
         void AddLast(T value)
         {
-            auto node = new LinkedListNode(this, value);
+            auto node = this->pool->Allocate(this, std::move(value));
             if (this->IsEmpty())
             {
                 this->head = node;
@@ -167,7 +186,7 @@ namespace DataStructures
                 throw std::exception();
             }
 
-            auto newNode = new LinkedListNode(this, value);
+            auto newNode = this->pool->Allocate(this, std::move(value));
             AddBefore(node, newNode);
             this->count++;
         }
@@ -181,7 +200,7 @@ namespace DataStructures
                 throw std::exception();
             }
 
-            auto newNode = new LinkedListNode(this, value);
+            auto newNode = this->pool->Allocate(this, std::move(value));
             AddAfter(node, newNode);
             this->count++;
         }
@@ -224,6 +243,79 @@ namespace DataStructures
             --this->count;
         }
 
+        /// \brief Moves the given \p node to the beginning of the list
+        /// \param node Node to move
+        void MoveFirst(LinkedListNode<T> *node)
+        {
+            if (node == nullptr || node->GetList() != this)
+            {
+                throw std::exception();
+            }
+
+            if (node == this->head)
+            {
+                return;
+            }
+
+            Unlink(node);
+            AddBefore(this->head, node);
+            this->head = node;
+        }
+
+        /// \brief Moves the given \p node after the \p position node, without reallocating it
+        /// \param node Node to move
+        /// \param position The node after which \p node will be placed
+        void MoveAfter(LinkedListNode<T> *node, LinkedListNode<T> *position)
+        {
+            if (node == nullptr || position == nullptr || node->GetList() != this || position->GetList() != this)
+            {
+                throw std::exception();
+            }
+
+            if (node == position)
+            {
+                return;
+            }
+
+            Unlink(node);
+            AddAfter(position, node);
+        }
+
+        /// \brief Moves the given \p node from the \p list to the end of this list without reallocating it. Both
+        /// lists must allocate their nodes from the same pool.
+        /// \param node Node to move
+        /// \param list The list containing \p node
+        void MoveLast(LinkedListNode<T> *node, LinkedList &list)
+        {
+            if (node == nullptr || node->GetList() != &list || list.pool != this->pool)
+            {
+                throw std::exception();
+            }
+
+            if (list.count == 1)
+            {
+                list.head = nullptr;
+            }
+            else
+            {
+                list.Unlink(node);
+            }
+
+            --list.count;
+            node->list = this;
+            if (this->IsEmpty())
+            {
+                this->head = node;
+                this->head->previous = this->head->next = this->head;
+            }
+            else
+            {
+                AddBefore(this->head, node);
+            }
+
+            this->count++;
+        }
+
         /// \brief Removes the given node from the list
         /// \param node Node to remove
         void RemoveNode(LinkedListNode<T>* node)
@@ -235,7 +327,7 @@ namespace DataStructures
 
             if (this->count == 1)
             {
-                delete node;
+                this->pool->Deallocate(node);
                 this->head = nullptr;
                 this->count = 0;
                 return;
@@ -250,7 +342,8 @@ namespace DataStructures
             --this->count;
         }
 
-        /// \brief Removes all the elements from the list
+        /// \brief Removes all the elements from the list. If the list owns its pool and the items are trivially
+        /// destructible, all the slabs are released at once without visiting the nodes.
         void Clear()
         {
             if (this->IsEmpty())
@@ -258,13 +351,21 @@ namespace DataStructures
                 return;
             }
 
+            if (std::is_trivially_destructible_v<T> && this->OwnsPool())
+            {
+                this->ownPool.Release();
+                this->head = nullptr;
+                this->count = 0;
+                return;
+            }
+
             LinkedListNode<T>* current = this->head;
             LinkedListNode<T>* nextNode = nullptr;
             this->head->previous->next = nullptr;
             while (current != nullptr)
             {
                 nextNode = current->next;
-                delete current;
+                this->pool->Deallocate(current);
                 current = nextNode;
             }
 
@@ -415,6 +516,20 @@ namespace DataStructures
             return nullptr;
         }
 
+        /// \brief Returns the pool, from which the nodes of the list are allocated
+        /// \return A pointer to the pool
+        PoolType *GetPool() const
+        {
+            return this->pool;
+        }
+
+        /// \brief Determines whether the list allocates its nodes from its own pool
+        /// \return \a true if the pool is not shared, \a false otherwise
+        bool OwnsPool() const
+        {
+            return this->pool == &this->ownPool;
+        }
+
         /// \brief Determines whether the list is empty
         /// \return \a true if the list has no elements, \a false otherwise
         bool IsEmpty() const
@@ -446,6 +561,8 @@ namespace DataStructures
     private:
         LinkedListNode<T> *head;
         int count;
+        PoolType ownPool;
+        PoolType *pool;
 
         static void AddBefore(LinkedListNode<T> *node, LinkedListNode<T> *newNode)
         {
@@ -463,11 +580,38 @@ namespace DataStructures
             node->next = newNode;
         }
 
-        static void Remove(LinkedListNode<T> *node)
+        /// \brief Adds copies of the items of the \p list at the end of this list
+        void AddAll(const LinkedList &list)
         {
+            LinkedListNode<T> *current = list.head;
+            if (current != nullptr)
+            {
+                do
+                {
+                    this->AddLast(current->GetValue());
+                    current = current->GetNext();
+                }
+                while (current != list.head);
+            }
+        }
+
+        void Remove(LinkedListNode<T> *node)
+        {
+            node->next->previous = node->previous;
+            node->previous->next = node->next;
+            this->pool->Deallocate(node);
+        }
+
+        /// \brief Detaches the \p node from its neighbours, the list must contain at least one more node
+        void Unlink(LinkedListNode<T> *node)
+        {
+            if (node == this->head)
+            {
+                this->head = this->head->next;
+            }
+
             node->next->previous = node->previous;
             node->previous->next = node->next;
-            delete node;
         }
     };
 }
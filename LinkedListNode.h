@@ -2,6 +2,7 @@
 #define PROJEKT1_LINKEDLISTNODE_H
 
 #include <iostream>
+#include <utility>
 
 namespace DataStructures
 {
@@ -20,14 +21,14 @@ namespace DataStructures
 
         /// \brief Constructs a linked list node containing the given \p value
         /// \param value A value for the new node
-        LinkedListNode(T value) : LinkedListNode(nullptr, value)
+        LinkedListNode(T value) : LinkedListNode(nullptr, std::move(value))
         {
         }
 
         /// \brief Constructs a linked list node containing the given \p value with a reference to the \p list
         /// \param list A linked list to which the reference is added
         /// \param value A value for the new node
-        LinkedListNode(LinkedList<T> *list, T value) : list(list), item(value), previous(nullptr), next(nullptr)
+        LinkedListNode(LinkedList<T> *list, T value) : list(list), item(std::move(value)), previous(nullptr), next(nullptr)
         {
         }
 
@@ -38,7 +39,14 @@ namespace DataStructures
 
         /// \brief Returns the value of the node
         /// \return The value that the node contains
-        T GetValue() const
+        const T &GetValue() const
+        {
+            return this->item;
+        }
+
+        /// \brief Returns the value of the node
+        /// \return The value that the node contains
+        T &GetValue()
         {
             return this->item;
         }
@@ -47,7 +55,7 @@ namespace DataStructures
         /// \param value A value to replace the current one with
         void SetValue(T value)
         {
-            this->item = value;
+            this->item = std::move(value);
         }
 
         /// \brief Returns a pointer to the previous node
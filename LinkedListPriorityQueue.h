@@ -1,22 +1,44 @@
 #ifndef PROJECT2_LINKEDLISTPRIORITYQUEUE_H
 #define PROJECT2_LINKEDLISTPRIORITYQUEUE_H
 
-#include "IPriorityQueue.h"
+#include "PriorityQueueBase.h"
 #include "LinkedList.h"
+#include "QueueItem.h"
+#include <stdexcept>
+#include <utility>
 
 namespace DataStructures
 {
-    class LinkedListPriorityQueue : public IPriorityQueue
+    /// \brief Represents a priority queue built on an unsorted circular doubly-linked list. Enqueue returns a handle
+    /// to the node of the item, which stays valid until the item is dequeued or removed, so the priority of the item
+    /// can be modified and the item can be removed in O(1).
+    /// \tparam E Type of the elements
+    /// \tparam P Type of the priorities
+    /// \tparam Compare Comparator of the priorities, the element with the greatest priority is dequeued first
+    template<typename E = int, typename P = int, typename Compare = std::less<P>>
+    class LinkedListPriorityQueue : public PriorityQueueBase<LinkedListPriorityQueue<E, P, Compare>, E, P, Compare>
     {
     public:
-        int GetCount() const
+        using Handle = LinkedListNode<QueueItem<E, P>> *;
+
+        explicit LinkedListPriorityQueue(const Compare &compare = Compare())
+            : PriorityQueueBase<LinkedListPriorityQueue<E, P, Compare>, E, P, Compare>(compare)
         {
-            return this->elements.GetCount();
         }
 
-        bool IsEmpty() const
+        /// \brief Constructs a queue containing the \p items
+        /// \param items A range of items to enqueue
+        /// \param compare Comparator of the priorities
+        template<QueueItemRange<E, P> R>
+        explicit LinkedListPriorityQueue(R &&items, const Compare &compare = Compare())
+            : LinkedListPriorityQueue(compare)
+        {
+            this->EnqueueRange(std::forward<R>(items));
+        }
+
+        int GetCount() const
         {
-            return this->elements.IsEmpty();
+            return this->elements.GetCount();
         }
 
         void Clear()
@@ -24,12 +46,28 @@ namespace DataStructures
             return this->elements.Clear();
         }
 
-        void Enqueue(int element, int priority)
+        /// \brief Enqueues the \p element with the given \p priority
+        /// \param element An element to enqueue
+        /// \param priority A priority of the element
+        /// \return A handle to the enqueued item
+        Handle Enqueue(E element, P priority)
         {
-            this->elements.AddLast({element, priority});
+            this->elements.AddLast({std::move(element), std::move(priority)});
+            return this->elements.GetLast();
         }
 
-        int Dequeue()
+        /// \brief Enqueues all the \p items at the end of the list
+        /// \param items A range of items to enqueue
+        template<QueueItemRange<E, P> R>
+        void EnqueueRange(R &&items)
+        {
+            for (auto &&item: items)
+            {
+                this->elements.AddLast(ForwardItem<R>(item));
+            }
+        }
+
+        E Dequeue()
         {
             if(this->IsEmpty())
             {
@@ -37,12 +75,12 @@ namespace DataStructures
             }
 
             auto node = GetMaxNode();
-            int element = node->GetValue().element;
+            E element = std::move(node->GetValue().element);
             this->elements.RemoveNode(node);
             return element;
         }
 
-        int Peek() const
+        const E &Peek() const
         {
             if(this->IsEmpty())
             {
@@ -53,30 +91,52 @@ namespace DataStructures
             return node->GetValue().element;
         }
 
-        void Modify(int element, int priority)
+        void Modify(const E &element, P priority)
         {
-            if(this->IsEmpty())
-            {
-                throw std::exception();
-            }
-
             auto node = this->elements.GetFirst();
             for(int i = 0; i < this->elements.GetCount(); i++)
             {
                 if(node->GetValue().element == element)
                 {
-                    node->SetValue({element, priority});
-                    break;
+                    node->GetValue().priority = std::move(priority);
+                    return;
                 }
 
-                node->GetNext();
+                node = node->GetNext();
             }
+
+            throw std::runtime_error("Element not found in priority queue.");
+        }
+
+        /// \brief Changes the priority of the item in O(1)
+        /// \param handle A handle returned by Enqueue
+        /// \param priority A new priority of the item
+        void Modify(Handle handle, P priority)
+        {
+            this->CheckHandle(handle);
+            handle->GetValue().priority = std::move(priority);
+        }
+
+        /// \brief Removes the item from the queue in O(1)
+        /// \param handle A handle returned by Enqueue, which becomes invalid
+        void Remove(Handle handle)
+        {
+            this->CheckHandle(handle);
+            this->elements.RemoveNode(handle);
         }
 
     private:
-        LinkedList<QueueItem<int, int>> elements;
+        LinkedList<QueueItem<E, P>> elements;
+
+        void CheckHandle(Handle handle) const
+        {
+            if (handle == nullptr || handle->GetList() != &this->elements)
+            {
+                throw std::runtime_error("Element not found in priority queue.");
+            }
+        }
 
-        LinkedListNode<QueueItem<int, int>>* GetMaxNode()
+        LinkedListNode<QueueItem<E, P>>* GetMaxNode()
         {
             auto node = this->elements.GetFirst();
             auto maxNode = node;
@@ -84,7 +144,7 @@ namespace DataStructures
             for(int i = 1; i < this->elements.GetCount(); i++)
             {
                 node = node->GetNext();
-                if(node->GetValue().priority > maxNode->GetValue().priority)
+                if(this->HasHigherPriority(node->GetValue().priority, maxNode->GetValue().priority))
                 {
                     maxNode = node;
                 }
@@ -93,7 +153,7 @@ namespace DataStructures
             return maxNode;
         }
 
-        const LinkedListNode<QueueItem<int, int>>* GetMaxNode() const
+        const LinkedListNode<QueueItem<E, P>>* GetMaxNode() const
         {
             auto node = this->elements.GetFirst();
             auto maxNode = node;
@@ -101,7 +161,7 @@ namespace DataStructures
             for(int i = 1; i < this->elements.GetCount(); i++)
             {
                 node = node->GetNext();
-                if(node->GetValue().priority > maxNode->GetValue().priority)
+                if(this->HasHigherPriority(node->GetValue().priority, maxNode->GetValue().priority))
                 {
                     maxNode = node;
                 }
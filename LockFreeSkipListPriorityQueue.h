@@ -0,0 +1,440 @@
+#ifndef PROJECT2_LOCKFREESKIPLISTPRIORITYQUEUE_H
+#define PROJECT2_LOCKFREESKIPLISTPRIORITYQUEUE_H
+
+#include "PriorityQueueBase.h"
+#include "EpochReclaimer.h"
+#include "QueueItem.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Represents a lock-free priority queue built on a skip list (Lindén and Jonsson, 2013), which can be
+    /// used by many threads at once. The lowest bit of a forward pointer on the lowest level marks the next node as
+    /// deleted, so Dequeue deletes the first live node with a single fetch_or and the deleted nodes always form
+    /// a prefix of the list. The prefix is unlinked in a batch by a single compare-and-swap on the head, only when
+    /// it is longer than BoundOffset, so most Dequeues do not write to the head at all. Unlinked nodes are deleted by
+    /// an EpochReclaimer.
+    /// Items with equal priorities are ordered by the addresses of their nodes, so they are dequeued in an
+    /// unspecified order. The items are never changed after they are enqueued: Dequeue, Peek and Modify copy the
+    /// elements, and Modify invalidates the item and enqueues its copy with the new priority.
+    /// \tparam E Type of the elements, copyable
+    /// \tparam P Type of the priorities
+    /// \tparam Compare Comparator of the priorities, the element with the greatest priority is dequeued first
+    template<typename E = int, typename P = int, typename Compare = std::less<P>>
+    class LockFreeSkipListPriorityQueue
+        : public PriorityQueueBase<LockFreeSkipListPriorityQueue<E, P, Compare>, E, P, Compare>
+    {
+        struct Node
+        {
+            std::atomic<std::uintptr_t> *next;
+            int height;
+            /// \brief Set until the node is linked on all its levels, the head is never moved past such a node
+            std::atomic<bool> inserting;
+            /// \brief Cleared by the thread, which takes the item, either Dequeue or Modify
+            std::atomic<bool> valid;
+            QueueItem<E, P> item;
+        };
+
+        struct NodeDeleter
+        {
+            void operator()(Node *node) const
+            {
+                DestroyNode(node);
+            }
+        };
+
+    public:
+        static const int MaxHeight = 16;
+        static const int BoundOffset = 32;
+
+        explicit LockFreeSkipListPriorityQueue(const Compare &compare = Compare())
+            : PriorityQueueBase<LockFreeSkipListPriorityQueue<E, P, Compare>, E, P, Compare>(compare),
+              head(CreateNode(MaxHeight, {})), tail(CreateNode(MaxHeight, {})), count(0)
+        {
+            for (int i = 0; i < MaxHeight; ++i)
+            {
+                this->head->next[i].store(ToLink(this->tail));
+            }
+
+            this->head->inserting.store(false);
+            this->tail->inserting.store(false);
+        }
+
+        /// \brief Constructs a queue containing the \p items
+        /// \param items A range of items to enqueue
+        /// \param compare Comparator of the priorities
+        template<QueueItemRange<E, P> R>
+        explicit LockFreeSkipListPriorityQueue(R &&items, const Compare &compare = Compare())
+            : LockFreeSkipListPriorityQueue(compare)
+        {
+            this->EnqueueRange(std::forward<R>(items));
+        }
+
+        LockFreeSkipListPriorityQueue(const LockFreeSkipListPriorityQueue &) = delete;
+
+        LockFreeSkipListPriorityQueue &operator=(const LockFreeSkipListPriorityQueue &) = delete;
+
+        /// \brief Destructs the queue freeing up all the nodes. No thread may use the queue.
+        ~LockFreeSkipListPriorityQueue()
+        {
+            Node *node = GetNode(this->head->next[0].load());
+            while (node != this->tail)
+            {
+                Node *next = GetNode(node->next[0].load());
+                DestroyNode(node);
+                node = next;
+            }
+
+            DestroyNode(this->head);
+            DestroyNode(this->tail);
+        }
+
+        /// \brief Returns the number of the items, which may change as soon as it is read
+        int GetCount() const
+        {
+            return this->count.load(std::memory_order_relaxed);
+        }
+
+        /// \brief Dequeues all the items. Safe to call concurrently.
+        void Clear()
+        {
+            E element;
+            while (this->TryDequeue(element))
+            {
+            }
+        }
+
+        /// \brief Enqueues the \p element with the given \p priority. Safe to call concurrently.
+        /// \param element An element to enqueue
+        /// \param priority A priority of the element
+        void Enqueue(E element, P priority)
+        {
+            auto guard = this->reclaimer.Protect();
+            Node *node = CreateNode(RandomHeight(), {std::move(element), std::move(priority)});
+            Node *predecessors[MaxHeight];
+            Node *successors[MaxHeight];
+
+            Node *deleted;
+            std::uintptr_t expected;
+            do
+            {
+                deleted = this->FindPredecessors(node, predecessors, successors);
+                node->next[0].store(ToLink(successors[0]));
+                expected = ToLink(successors[0]);
+            } while (!predecessors[0]->next[0].compare_exchange_strong(expected, ToLink(node)));
+
+            this->count.fetch_add(1, std::memory_order_relaxed);
+
+            for (int i = 1; i < node->height;)
+            {
+                node->next[i].store(ToLink(successors[i]));
+                if (IsMarked(node->next[0].load()) || IsMarked(successors[i]->next[0].load()) ||
+                    successors[i] == deleted)
+                {
+                    // Węzeł albo jego następnik został już usunięty
+                    break;
+                }
+
+                expected = ToLink(successors[i]);
+                if (predecessors[i]->next[i].compare_exchange_strong(expected, ToLink(node)))
+                {
+                    ++i;
+                }
+                else
+                {
+                    deleted = this->FindPredecessors(node, predecessors, successors);
+                    if (successors[0] != node)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            node->inserting.store(false);
+        }
+
+        /// \brief Dequeues the element with the greatest priority. Safe to call concurrently.
+        /// \param element A reference receiving the dequeued element
+        /// \return \a true if an element was dequeued, \a false if the queue was empty
+        bool TryDequeue(E &element)
+        {
+            auto guard = this->reclaimer.Protect();
+            while (true)
+            {
+                Node *node = this->DeleteFirst();
+                if (node == nullptr)
+                {
+                    return false;
+                }
+
+                if (node->valid.exchange(false))
+                {
+                    element = node->item.element;
+                    this->count.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+        }
+
+        /// \brief Dequeues the element with the greatest priority. Safe to call concurrently.
+        /// \return The dequeued element
+        E Dequeue()
+        {
+            E element;
+            if (!this->TryDequeue(element))
+            {
+                throw std::exception();
+            }
+
+            return element;
+        }
+
+        /// \brief Returns a copy of the element with the greatest priority, which may be dequeued by another
+        /// thread as soon as it is read
+        E Peek() const
+        {
+            auto guard = this->reclaimer.Protect();
+            Node *node = this->head;
+            while (true)
+            {
+                std::uintptr_t link = node->next[0].load();
+                node = GetNode(link);
+                if (node == this->tail)
+                {
+                    throw std::exception();
+                }
+
+                if (!IsMarked(link) && node->valid.load())
+                {
+                    return node->item.element;
+                }
+            }
+        }
+
+        /// \brief Changes the priority of the \p element. The item is invalidated and its copy is enqueued with
+        /// the new \p priority. Safe to call concurrently.
+        /// \param element An element to modify
+        /// \param priority A new priority of the element
+        void Modify(const E &element, P priority)
+        {
+            auto guard = this->reclaimer.Protect();
+            Node *node = this->head;
+            while (true)
+            {
+                std::uintptr_t link = node->next[0].load();
+                node = GetNode(link);
+                if (node == this->tail)
+                {
+                    throw std::runtime_error("Element not found in priority queue.");
+                }
+
+                if (!IsMarked(link) && node->valid.load() && node->item.element == element &&
+                    node->valid.exchange(false))
+                {
+                    this->count.fetch_sub(1, std::memory_order_relaxed);
+                    this->Enqueue(node->item.element, std::move(priority));
+                    return;
+                }
+            }
+        }
+
+    private:
+        static constexpr std::size_t LinksOffset =
+                (sizeof(Node) + alignof(std::atomic<std::uintptr_t>) - 1) / alignof(std::atomic<std::uintptr_t>) *
+                alignof(std::atomic<std::uintptr_t>);
+        static const std::uintptr_t Mark = 1;
+
+        Node *head;
+        Node *tail;
+        std::atomic<int> count;
+        mutable EpochReclaimer<Node, NodeDeleter> reclaimer;
+
+        static Node *GetNode(std::uintptr_t link)
+        {
+            return reinterpret_cast<Node *>(link & ~Mark);
+        }
+
+        static bool IsMarked(std::uintptr_t link)
+        {
+            return (link & Mark) != 0;
+        }
+
+        static std::uintptr_t ToLink(Node *node)
+        {
+            return reinterpret_cast<std::uintptr_t>(node);
+        }
+
+        static Node *CreateNode(int height, QueueItem<E, P> item)
+        {
+            auto memory = static_cast<unsigned char *>(
+                    ::operator new(LinksOffset + height * sizeof(std::atomic<std::uintptr_t>),
+                                   std::align_val_t(alignof(Node))));
+            auto links = reinterpret_cast<std::atomic<std::uintptr_t> *>(memory + LinksOffset);
+            for (int i = 0; i < height; ++i)
+            {
+                new(links + i) std::atomic<std::uintptr_t>(0);
+            }
+
+            return new(memory) Node{links, height, true, true, std::move(item)};
+        }
+
+        static void DestroyNode(Node *node)
+        {
+            node->~Node();
+            ::operator delete(node, std::align_val_t(alignof(Node)));
+        }
+
+        /// \brief Draws the height of a new node with a xorshift generator owned by the calling thread, each level
+        /// is present with the probability of 1/4
+        static int RandomHeight()
+        {
+            thread_local std::uint64_t state = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            int height = 1;
+            std::uint64_t bits = state;
+            while ((bits & 3) == 0 && height < MaxHeight)
+            {
+                ++height;
+                bits >>= 2;
+            }
+
+            return height;
+        }
+
+        /// \brief Determines whether the \p first node precedes the \p second one. Equal priorities are ordered by
+        /// the addresses, so all the levels agree on the order of every pair of nodes.
+        bool Precedes(const Node *first, const Node *second) const
+        {
+            if (this->HasHigherPriority(first->item.priority, second->item.priority))
+            {
+                return true;
+            }
+
+            return !this->HasHigherPriority(second->item.priority, first->item.priority) &&
+                   std::less<const Node *>()(first, second);
+        }
+
+        /// \brief Finds the predecessors and the successors of the \p node on every level, skipping the deleted
+        /// prefix of the list
+        /// \return The last deleted node passed on the lowest level, or nullptr
+        Node *FindPredecessors(const Node *node, Node **predecessors, Node **successors) const
+        {
+            Node *predecessor = this->head;
+            Node *deleted = nullptr;
+            for (int i = MaxHeight - 1; i >= 0; --i)
+            {
+                std::uintptr_t link = predecessor->next[i].load();
+                Node *current = GetNode(link);
+                while (current != this->tail &&
+                       (this->Precedes(current, node) || IsMarked(current->next[0].load()) ||
+                        (i == 0 && IsMarked(link))))
+                {
+                    if (i == 0 && IsMarked(link))
+                    {
+                        deleted = current;
+                    }
+
+                    predecessor = current;
+                    link = predecessor->next[i].load();
+                    current = GetNode(link);
+                }
+
+                predecessors[i] = predecessor;
+                successors[i] = current;
+            }
+
+            return deleted;
+        }
+
+        /// \brief Logically deletes the first live node by marking the pointer of its predecessor. When the deleted
+        /// prefix becomes longer than BoundOffset, it is unlinked and retired.
+        /// \return The deleted node, or nullptr if the list was empty
+        Node *DeleteFirst()
+        {
+            std::uintptr_t observedHead = this->head->next[0].load();
+            Node *node = this->head;
+            Node *newHead = nullptr;
+            int offset = 0;
+            std::uintptr_t link;
+            do
+            {
+                link = node->next[0].load();
+                if (GetNode(link) == this->tail)
+                {
+                    return nullptr;
+                }
+
+                if (newHead == nullptr && node->inserting.load())
+                {
+                    newHead = node;
+                }
+
+                link = node->next[0].fetch_or(Mark);
+                ++offset;
+                node = GetNode(link);
+            } while (IsMarked(link));
+
+            if (newHead == nullptr)
+            {
+                newHead = node;
+            }
+
+            if (offset > BoundOffset && this->head->next[0].load() == observedHead &&
+                this->head->next[0].compare_exchange_strong(observedHead, ToLink(newHead) | Mark))
+            {
+                this->Restructure();
+
+                Node *current = GetNode(observedHead);
+                while (current != newHead)
+                {
+                    Node *next = GetNode(current->next[0].load());
+                    this->reclaimer.Retire(current);
+                    current = next;
+                }
+            }
+
+            return node;
+        }
+
+        /// \brief Moves the upper-level pointers of the head past the deleted prefix
+        void Restructure()
+        {
+            Node *predecessor = this->head;
+            for (int i = MaxHeight - 1; i > 0;)
+            {
+                std::uintptr_t first = this->head->next[i].load();
+                if (!IsMarked(GetNode(first)->next[0].load()))
+                {
+                    --i;
+                    continue;
+                }
+
+                Node *current = GetNode(predecessor->next[i].load());
+                while (IsMarked(current->next[0].load()))
+                {
+                    predecessor = current;
+                    current = GetNode(predecessor->next[i].load());
+                }
+
+                if (this->head->next[i].compare_exchange_strong(first, predecessor->next[i].load()))
+                {
+                    --i;
+                }
+            }
+        }
+    };
+
+} // DataStructures
+
+#endif //PROJECT2_LOCKFREESKIPLISTPRIORITYQUEUE_H
@@ -0,0 +1,335 @@
+#ifndef PROJECT2_MINMAXHEAPPRIORITYQUEUE_H
+#define PROJECT2_MINMAXHEAPPRIORITYQUEUE_H
+
+#include "PriorityQueueBase.h"
+#include "DynamicArray.h"
+#include "QueueItem.h"
+#include <bit>
+#include <stdexcept>
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Represents a min-max heap, a double-ended priority queue. The nodes on even levels are not lower than
+    /// their descendants and the nodes on odd levels are not greater than them, so the item with the greatest
+    /// priority is the root and the item with the lowest priority is one of its children. Both ends can be peeked in
+    /// O(1) and dequeued in O(log n). Peek and Dequeue refer to the greatest priority.
+    /// \tparam E Type of the elements
+    /// \tparam P Type of the priorities
+    /// \tparam Compare Comparator of the priorities, the element with the greatest priority is dequeued first
+    template<typename E = int, typename P = int, typename Compare = std::less<P>>
+    class MinMaxHeapPriorityQueue
+        : public PriorityQueueBase<MinMaxHeapPriorityQueue<E, P, Compare>, E, P, Compare>
+    {
+    public:
+        explicit MinMaxHeapPriorityQueue(const Compare &compare = Compare())
+            : PriorityQueueBase<MinMaxHeapPriorityQueue<E, P, Compare>, E, P, Compare>(compare)
+        {
+        }
+
+        /// \brief Constructs a heap containing the \p items in O(n)
+        /// \param items A range of items to enqueue
+        /// \param compare Comparator of the priorities
+        template<QueueItemRange<E, P> R>
+        explicit MinMaxHeapPriorityQueue(R &&items, const Compare &compare = Compare())
+            : MinMaxHeapPriorityQueue(compare)
+        {
+            this->EnqueueRange(std::forward<R>(items));
+        }
+
+        int GetCount() const
+        {
+            return this->items.GetLength();
+        }
+
+        void Clear()
+        {
+            this->items.Clear();
+        }
+
+        void Enqueue(E element, P priority)
+        {
+            this->items.Add({std::move(element), std::move(priority)});
+            this->BubbleUp(this->GetCount() - 1);
+        }
+
+        /// \brief Enqueues all the \p items, reserving the memory once. If the batch is larger than the heap,
+        /// the heap is rebuilt bottom-up in O(n), otherwise every new item is bubbled up.
+        /// \param items A range of items to enqueue
+        template<QueueItemRange<E, P> R>
+        void EnqueueRange(R &&items)
+        {
+            int oldCount = this->GetCount();
+            if constexpr (std::ranges::sized_range<R>)
+            {
+                this->items.Reserve(oldCount + static_cast<int>(std::ranges::size(items)));
+            }
+
+            for (auto &&item: items)
+            {
+                this->items.Add(ForwardItem<R>(item));
+            }
+
+            int count = this->GetCount();
+            if (count - oldCount > oldCount)
+            {
+                for (int i = count / 2 - 1; i >= 0; --i)
+                {
+                    this->TrickleDown(i);
+                }
+            }
+            else
+            {
+                for (int i = oldCount; i < count; ++i)
+                {
+                    this->BubbleUp(i);
+                }
+            }
+        }
+
+        E Dequeue()
+        {
+            return this->DequeueMax();
+        }
+
+        const E &Peek() const
+        {
+            return this->PeekMax();
+        }
+
+        /// \brief Returns the element with the greatest priority in O(1)
+        const E &PeekMax() const
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            return this->items[0].element;
+        }
+
+        /// \brief Returns the element with the lowest priority in O(1)
+        const E &PeekMin() const
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            return this->items[this->GetMinIndex()].element;
+        }
+
+        /// \brief Removes and returns the element with the greatest priority in O(log n)
+        E DequeueMax()
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            return this->RemoveAtIndex(0);
+        }
+
+        /// \brief Removes and returns the element with the lowest priority in O(log n)
+        E DequeueMin()
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            return this->RemoveAtIndex(this->GetMinIndex());
+        }
+
+        void Modify(const E &element, P priority)
+        {
+            int index = -1;
+            for (int i = 0; i < this->GetCount(); ++i)
+            {
+                if (this->items[i].element == element)
+                {
+                    index = i;
+                    break;
+                }
+            }
+
+            if (index == -1)
+            {
+                throw std::runtime_error("Element not found in priority queue.");
+            }
+
+            this->items[index].priority = std::move(priority);
+            this->BubbleUp(this->TrickleDown(index));
+        }
+
+    private:
+        DynamicArray<QueueItem<E, P>> items;
+
+        static bool IsMaxLevel(int index)
+        {
+            return (std::bit_width(static_cast<unsigned>(index + 1)) & 1) == 1;
+        }
+
+        /// \brief Determines whether the item at \p first belongs closer to the root than the item at \p second
+        /// on the levels of the given kind
+        template<bool Max>
+        bool IsBefore(int first, int second) const
+        {
+            return Max ? this->HasHigherPriority(this->items[first].priority, this->items[second].priority)
+                       : this->HasHigherPriority(this->items[second].priority, this->items[first].priority);
+        }
+
+        int GetMinIndex() const
+        {
+            if (this->GetCount() < 3)
+            {
+                return this->GetCount() - 1;
+            }
+
+            return this->IsBefore<false>(1, 2) ? 1 : 2;
+        }
+
+        void Swap(int first, int second)
+        {
+            QueueItem<E, P> item = std::move(this->items[first]);
+            this->items[first] = std::move(this->items[second]);
+            this->items[second] = std::move(item);
+        }
+
+        E RemoveAtIndex(int index)
+        {
+            E element = std::move(this->items[index].element);
+            int last = this->GetCount() - 1;
+            if (index != last)
+            {
+                this->items[index] = std::move(this->items[last]);
+            }
+
+            this->items.RemoveLast();
+            if (index < last)
+            {
+                this->BubbleUp(this->TrickleDown(index));
+            }
+
+            return element;
+        }
+
+        /// \brief Moves the item at the \p index up, first across the parent if it belongs to the other kind of
+        /// levels, and then along the grandparents
+        void BubbleUp(int index)
+        {
+            if (index == 0)
+            {
+                return;
+            }
+
+            int parent = (index - 1) / 2;
+            if (IsMaxLevel(index))
+            {
+                if (this->IsBefore<false>(index, parent))
+                {
+                    this->Swap(index, parent);
+                    this->BubbleUpLevels<false>(parent);
+                }
+                else
+                {
+                    this->BubbleUpLevels<true>(index);
+                }
+            }
+            else
+            {
+                if (this->IsBefore<true>(index, parent))
+                {
+                    this->Swap(index, parent);
+                    this->BubbleUpLevels<true>(parent);
+                }
+                else
+                {
+                    this->BubbleUpLevels<false>(index);
+                }
+            }
+        }
+
+        template<bool Max>
+        void BubbleUpLevels(int index)
+        {
+            while (index > 2)
+            {
+                int grandparent = ((index - 1) / 2 - 1) / 2;
+                if (!this->IsBefore<Max>(index, grandparent))
+                {
+                    break;
+                }
+
+                this->Swap(index, grandparent);
+                index = grandparent;
+            }
+        }
+
+        /// \brief Moves the item at the \p index down the levels of its kind. When the item is swapped with the
+        /// parent of a grandchild, it stays on the other kind of levels, and the item taken from there continues
+        /// down instead.
+        /// \return The final index of the item, from which it may still have to be bubbled up
+        int TrickleDown(int index)
+        {
+            return IsMaxLevel(index) ? this->TrickleDownLevels<true>(index) : this->TrickleDownLevels<false>(index);
+        }
+
+        template<bool Max>
+        int TrickleDownLevels(int index)
+        {
+            int count = this->GetCount();
+            int position = -1;
+            while (true)
+            {
+                int child = 2 * index + 1;
+                if (child >= count)
+                {
+                    break;
+                }
+
+                // Najlepszy spośród dzieci i wnuków
+                int best = child;
+                if (child + 1 < count && this->IsBefore<Max>(child + 1, best))
+                {
+                    best = child + 1;
+                }
+
+                for (int i = 2 * child + 1; i < 2 * child + 5 && i < count; ++i)
+                {
+                    if (this->IsBefore<Max>(i, best))
+                    {
+                        best = i;
+                    }
+                }
+
+                if (!this->IsBefore<Max>(best, index))
+                {
+                    break;
+                }
+
+                this->Swap(index, best);
+                index = best;
+                if (best <= child + 1)
+                {
+                    break;
+                }
+
+                int parent = (best - 1) / 2;
+                if (this->IsBefore<Max>(parent, best))
+                {
+                    this->Swap(best, parent);
+                    if (position == -1)
+                    {
+                        position = parent;
+                    }
+                }
+            }
+
+            return position == -1 ? index : position;
+        }
+    };
+
+} // DataStructures
+
+#endif //PROJECT2_MINMAXHEAPPRIORITYQUEUE_H
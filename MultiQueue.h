@@ -0,0 +1,314 @@
+#ifndef PROJECT2_MULTIQUEUE_H
+#define PROJECT2_MULTIQUEUE_H
+
+#include "PriorityQueueBase.h"
+#include "CacheAlignedAllocator.h"
+#include "HeapPriorityQueue.h"
+#include "ThreadSlots.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Statistics of a MultiQueue, gathered since its construction
+    struct MultiQueueStatistics
+    {
+        /// \brief Number of the enqueued items
+        long long enqueues = 0;
+        /// \brief Number of the dequeued items
+        long long dequeues = 0;
+        /// \brief Number of the attempts to lock a shard, which was already locked by another thread
+        long long contentions = 0;
+        /// \brief Number of the dequeues, for which the rank error was estimated
+        long long rankSamples = 0;
+        /// \brief Sum of the estimated rank errors
+        long long rankErrorSum = 0;
+        /// \brief Greatest estimated rank error
+        long long rankErrorMax = 0;
+
+        /// \brief Returns the mean estimated rank error of the sampled dequeues
+        double GetMeanRankError() const
+        {
+            return this->rankSamples == 0 ? 0.0 : static_cast<double>(this->rankErrorSum) / this->rankSamples;
+        }
+    };
+
+    /// \brief Represents a relaxed priority queue, which can be used by many threads at once (Rihani, Sanders and
+    /// Dementiev, 2015). The items are spread over c * p shards, each a HeapPriorityQueue guarded by its own mutex.
+    /// Enqueue puts the item into a random shard, and Dequeue takes the better top of two random shards, so the
+    /// dequeued element is close to, but not always, the element with the greatest priority. A busy shard is
+    /// skipped instead of waited for. Every shard caches the priority of its top, so choosing between two shards
+    /// does not lock them.
+    /// The rank error of a dequeue is estimated as the number of the shards, whose tops are better than the dequeued
+    /// priority. It is a lower bound of the true rank error, computed for every RankSampleInterval-th dequeue of
+    /// every thread.
+    /// Every thread using the queue keeps its random generator and its dequeue counter in one of MaxThreads slots,
+    /// which it takes on its first operation and keeps until the queue is destroyed.
+    /// \tparam E Type of the elements
+    /// \tparam P Type of the priorities, trivially copyable so that the tops can be cached in atomics
+    /// \tparam Compare Comparator of the priorities, the element with the greatest priority is dequeued first
+    template<typename E = int, typename P = int, typename Compare = std::less<P>>
+    class MultiQueue : public PriorityQueueBase<MultiQueue<E, P, Compare>, E, P, Compare>
+    {
+        static_assert(std::is_trivially_copyable_v<P>, "P must be trivially copyable");
+
+    public:
+        static const int MaxThreads = 128;
+        static const int RankSampleInterval = 64;
+
+        /// \brief Constructs an empty queue for the given number of threads
+        /// \param threadCount Number of the threads p using the queue, greater than 0
+        /// \param factor Relaxation factor c, the number of the shards per thread, greater than 0. More shards
+        /// lower the contention and raise the rank error.
+        /// \param compare Comparator of the priorities
+        explicit MultiQueue(int threadCount, int factor = 2, const Compare &compare = Compare())
+            : PriorityQueueBase<MultiQueue<E, P, Compare>, E, P, Compare>(compare), shardCount(threadCount * factor)
+        {
+            if (threadCount <= 0 || factor <= 0)
+            {
+                throw std::invalid_argument("Number of threads and relaxation factor must be positive.");
+            }
+
+            this->shards = std::make_unique<Shard[]>(this->shardCount);
+            for (int i = 0; i < this->shardCount; ++i)
+            {
+                this->shards[i].heap = HeapPriorityQueue<E, P, Compare>(compare);
+            }
+        }
+
+        /// \brief Returns the number of the items, which may change as soon as it is read
+        int GetCount() const
+        {
+            int count = 0;
+            for (int i = 0; i < this->shardCount; ++i)
+            {
+                count += this->shards[i].count.load(std::memory_order_relaxed);
+            }
+
+            return count;
+        }
+
+        /// \brief Returns the number of the shards c * p
+        int GetShardCount() const
+        {
+            return this->shardCount;
+        }
+
+        /// \brief Enqueues the \p element with the given \p priority into a random shard. Safe to call concurrently.
+        /// \param element An element to enqueue
+        /// \param priority A priority of the element
+        void Enqueue(E element, P priority)
+        {
+            Shard &shard = this->LockRandomShard();
+            shard.heap.Enqueue(std::move(element), priority);
+            ++shard.enqueues;
+            this->Update(shard);
+            shard.lock.unlock();
+        }
+
+        /// \brief Dequeues the element from the better top of two random shards. Safe to call concurrently.
+        /// \param element A reference receiving the dequeued element
+        /// \return \a true if an element was dequeued, \a false if all the shards were empty
+        bool TryDequeue(E &element)
+        {
+            ThreadState &state = this->threads.GetSlot();
+
+            while (true)
+            {
+                int first = this->RandomShard(state);
+                int second = this->RandomShard(state);
+                bool firstEmpty = this->shards[first].count.load(std::memory_order_acquire) == 0;
+                bool secondEmpty = this->shards[second].count.load(std::memory_order_acquire) == 0;
+
+                if (firstEmpty && secondEmpty)
+                {
+                    first = this->FindNonEmptyShard();
+                    if (first == -1)
+                    {
+                        return false;
+                    }
+                }
+                else if (firstEmpty || (!secondEmpty &&
+                                        this->HasHigherPriority(this->shards[second].top.load(std::memory_order_relaxed),
+                                                                this->shards[first].top.load(std::memory_order_relaxed))))
+                {
+                    first = second;
+                }
+
+                Shard &shard = this->shards[first];
+                if (!shard.lock.try_lock())
+                {
+                    shard.contentions.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+
+                if (shard.heap.IsEmpty())
+                {
+                    // Inny wątek opróżnił kopiec po odczytaniu licznika
+                    shard.lock.unlock();
+                    continue;
+                }
+
+                if (++state.dequeues % RankSampleInterval == 0)
+                {
+                    this->SampleRankError(shard, shard.heap.PeekPriority());
+                }
+
+                element = shard.heap.Dequeue();
+                ++shard.dequeues;
+                this->Update(shard);
+                shard.lock.unlock();
+                return true;
+            }
+        }
+
+        /// \brief Dequeues the element from the better top of two random shards. Safe to call concurrently.
+        /// \return The dequeued element
+        E Dequeue()
+        {
+            E element;
+            if (!this->TryDequeue(element))
+            {
+                throw std::exception();
+            }
+
+            return element;
+        }
+
+        /// \brief Sums the statistics of all the shards. Safe to call concurrently, but the shards are read
+        /// one by one, so the result is not a snapshot of a single moment.
+        MultiQueueStatistics GetStatistics() const
+        {
+            MultiQueueStatistics statistics;
+            for (int i = 0; i < this->shardCount; ++i)
+            {
+                Shard &shard = this->shards[i];
+                std::lock_guard<std::mutex> guard(shard.lock);
+                statistics.enqueues += shard.enqueues;
+                statistics.dequeues += shard.dequeues;
+                statistics.contentions += shard.contentions.load(std::memory_order_relaxed);
+                statistics.rankSamples += shard.rankSamples;
+                statistics.rankErrorSum += shard.rankErrorSum;
+                if (shard.rankErrorMax > statistics.rankErrorMax)
+                {
+                    statistics.rankErrorMax = shard.rankErrorMax;
+                }
+            }
+
+            return statistics;
+        }
+
+    private:
+        struct ThreadState
+        {
+            std::uint64_t random = 0;
+            int dequeues = 0;
+        };
+
+        struct alignas(CacheLineSize) Shard
+        {
+            std::mutex lock;
+            HeapPriorityQueue<E, P, Compare> heap;
+            std::atomic<int> count = 0;
+            std::atomic<P> top = P();
+            std::atomic<long long> contentions = 0;
+            long long enqueues = 0;
+            long long dequeues = 0;
+            long long rankSamples = 0;
+            long long rankErrorSum = 0;
+            long long rankErrorMax = 0;
+        };
+
+        std::unique_ptr<Shard[]> shards;
+        int shardCount;
+        ThreadSlots<ThreadState, MaxThreads> threads;
+
+        /// \brief Draws the index of a shard with the xorshift generator of the calling thread's \p state
+        int RandomShard(ThreadState &state) const
+        {
+            if (state.random == 0)
+            {
+                state.random = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+            }
+
+            state.random ^= state.random << 13;
+            state.random ^= state.random >> 7;
+            state.random ^= state.random << 17;
+            return static_cast<int>(state.random % static_cast<std::uint64_t>(this->shardCount));
+        }
+
+        /// \brief Locks a random shard, drawing another one whenever the drawn shard is busy
+        Shard &LockRandomShard()
+        {
+            ThreadState &state = this->threads.GetSlot();
+            while (true)
+            {
+                Shard &shard = this->shards[this->RandomShard(state)];
+                if (shard.lock.try_lock())
+                {
+                    return shard;
+                }
+
+                shard.contentions.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        /// \brief Returns the index of the first shard, which seems non-empty, or -1 if all of them are empty
+        int FindNonEmptyShard() const
+        {
+            for (int i = 0; i < this->shardCount; ++i)
+            {
+                if (this->shards[i].count.load(std::memory_order_acquire) != 0)
+                {
+                    return i;
+                }
+            }
+
+            return -1;
+        }
+
+        /// \brief Publishes the size and the top priority of the locked \p shard
+        static void Update(Shard &shard)
+        {
+            if (!shard.heap.IsEmpty())
+            {
+                shard.top.store(shard.heap.PeekPriority(), std::memory_order_relaxed);
+            }
+
+            shard.count.store(shard.heap.GetCount(), std::memory_order_release);
+        }
+
+        /// \brief Counts the other shards, whose tops are better than the \p priority dequeued from the locked
+        /// \p shard
+        void SampleRankError(Shard &shard, const P &priority)
+        {
+            long long error = 0;
+            for (int i = 0; i < this->shardCount; ++i)
+            {
+                const Shard &other = this->shards[i];
+                if (&other != &shard && other.count.load(std::memory_order_acquire) != 0 &&
+                    this->HasHigherPriority(other.top.load(std::memory_order_relaxed), priority))
+                {
+                    ++error;
+                }
+            }
+
+            ++shard.rankSamples;
+            shard.rankErrorSum += error;
+            if (error > shard.rankErrorMax)
+            {
+                shard.rankErrorMax = error;
+            }
+        }
+    };
+
+} // DataStructures
+
+#endif //PROJECT2_MULTIQUEUE_H
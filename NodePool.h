@@ -0,0 +1,159 @@
+#ifndef PROJECT2_NODEPOOL_H
+#define PROJECT2_NODEPOOL_H
+
+#include <new>
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Represents a slab allocator of nodes. Nodes are cut from slabs of growing size one after another, so
+    /// nodes allocated in a row lie next to each other, and the released ones are kept on a free list for reuse.
+    /// A single pool may be shared by many containers, and the slabs of one pool can be taken over by another in O(1).
+    /// \tparam T Type of the nodes
+    template<typename T>
+    class NodePool
+    {
+    public:
+        static const int InitialSlabSize = 32;
+        static const int MaxSlabSize = 4096;
+
+        /// \brief Constructs an empty pool, the first slab is allocated with the first node
+        NodePool() : slabs(nullptr), oldestSlab(nullptr), freeList(nullptr), next(nullptr), end(nullptr),
+                     slabSize(InitialSlabSize), slabCount(0)
+        {
+        }
+
+        NodePool(const NodePool &) = delete;
+
+        NodePool &operator=(const NodePool &) = delete;
+
+        /// \brief Destructs the pool freeing up all the slabs. The nodes must have been destroyed before.
+        ~NodePool()
+        {
+            this->Release();
+        }
+
+        /// \brief Constructs a new node from the \p arguments in a recycled or fresh slot
+        /// \param arguments Arguments of the node constructor
+        /// \return A pointer to the new node
+        template<typename... Args>
+        T *Allocate(Args &&... arguments)
+        {
+            Slot *slot;
+            if (this->freeList != nullptr)
+            {
+                slot = this->freeList;
+                this->freeList = slot->nextFree;
+            }
+            else
+            {
+                if (this->next == this->end)
+                {
+                    this->AddSlab();
+                }
+
+                slot = this->next++;
+            }
+
+            return ::new(static_cast<void *>(slot->storage)) T(std::forward<Args>(arguments)...);
+        }
+
+        /// \brief Destroys the \p node and puts its slot on the free list
+        /// \param node A node allocated from this pool
+        void Deallocate(T *node)
+        {
+            node->~T();
+            Slot *slot = reinterpret_cast<Slot *>(node);
+            slot->nextFree = this->freeList;
+            this->freeList = slot;
+        }
+
+        /// \brief Frees up all the slabs at once without destroying the nodes, which must be either destroyed
+        /// already or trivially destructible. Every node allocated from the pool becomes invalid.
+        void Release()
+        {
+            while (this->slabs != nullptr)
+            {
+                Slot *slab = this->slabs;
+                this->slabs = slab->nextFree;
+                ::operator delete(slab, std::align_val_t(alignof(Slot)));
+            }
+
+            this->Reset();
+        }
+
+        /// \brief Takes over all the slabs of the \p pool in O(1), so the nodes allocated from the \p pool can be
+        /// released to this pool and are freed up together with it. The free slots of the \p pool are not reused.
+        /// \param pool A pool, which is left empty
+        void Absorb(NodePool &pool)
+        {
+            if (&pool == this || pool.slabs == nullptr)
+            {
+                return;
+            }
+
+            pool.oldestSlab->nextFree = this->slabs;
+            if (this->slabs == nullptr)
+            {
+                this->oldestSlab = pool.oldestSlab;
+            }
+
+            this->slabs = pool.slabs;
+            this->slabCount += pool.slabCount;
+            pool.Reset();
+        }
+
+        /// \brief Returns the number of slabs allocated by the pool
+        /// \return Number of slabs
+        int GetSlabCount() const
+        {
+            return this->slabCount;
+        }
+
+    private:
+        union Slot
+        {
+            Slot *nextFree;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        /// \brief The most recent slab, the first slot of every slab links to the previous one
+        Slot *slabs;
+        Slot *oldestSlab;
+        Slot *freeList;
+        Slot *next;
+        Slot *end;
+        int slabSize;
+        int slabCount;
+
+        void AddSlab()
+        {
+            auto slab = static_cast<Slot *>(::operator new(sizeof(Slot) * (this->slabSize + 1),
+                                                           std::align_val_t(alignof(Slot))));
+            slab->nextFree = this->slabs;
+            if (this->slabs == nullptr)
+            {
+                this->oldestSlab = slab;
+            }
+
+            this->slabs = slab;
+            ++this->slabCount;
+            this->next = slab + 1;
+            this->end = slab + 1 + this->slabSize;
+
+            if (this->slabSize < MaxSlabSize)
+            {
+                this->slabSize *= 2;
+            }
+        }
+
+        void Reset()
+        {
+            this->slabs = this->oldestSlab = this->freeList = this->next = this->end = nullptr;
+            this->slabSize = InitialSlabSize;
+            this->slabCount = 0;
+        }
+    };
+}
+
+#endif //PROJECT2_NODEPOOL_H
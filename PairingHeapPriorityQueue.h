@@ -0,0 +1,467 @@
+#ifndef PROJECT2_PAIRINGHEAPPRIORITYQUEUE_H
+#define PROJECT2_PAIRINGHEAPPRIORITYQUEUE_H
+
+#include "PriorityQueueBase.h"
+#include "DynamicArray.h"
+#include "NodePool.h"
+#include "QueueItem.h"
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Represents a pairing heap priority queue. Enqueue and Meld take O(1), Dequeue takes amortized
+    /// O(log n), and raising the priority of an item through its handle takes amortized o(log n). The nodes are
+    /// allocated from a pool owned by the queue; melding takes over the slabs of the other queue together with
+    /// its nodes. Every node refers to an owner token of the queue, and melding makes the token of the other queue
+    /// a child of this queue's token, so a handle is checked to belong to the queue by finding the root of its
+    /// token in a disjoint-set forest.
+    /// \tparam E Type of the elements
+    /// \tparam P Type of the priorities
+    /// \tparam Compare Comparator of the priorities, the element with the greatest priority is dequeued first
+    template<typename E = int, typename P = int, typename Compare = std::less<P>>
+    class PairingHeapPriorityQueue
+        : public PriorityQueueBase<PairingHeapPriorityQueue<E, P, Compare>, E, P, Compare>
+    {
+        struct Owner
+        {
+            /// \brief Token of the queue, which melded the queue of this token, or nullptr for the current token
+            Owner *parent;
+            /// \brief Next token kept by the same queue
+            Owner *next;
+        };
+
+        /// \brief Represents a node of the heap. The previous node is the parent of the first child and the left
+        /// sibling of every other child. The owner follows the fields overlapped by the free list of the pool and
+        /// is cleared when the node is released.
+        struct Node
+        {
+            QueueItem<E, P> item;
+            Node *child;
+            Node *sibling;
+            Node *previous;
+            Owner *owner;
+        };
+
+    public:
+        using Handle = Node *;
+
+        explicit PairingHeapPriorityQueue(const Compare &compare = Compare())
+            : PriorityQueueBase<PairingHeapPriorityQueue<E, P, Compare>, E, P, Compare>(compare), root(nullptr),
+              count(0), owner(nullptr), lastOwner(nullptr)
+        {
+        }
+
+        /// \brief Constructs a queue containing the \p items
+        /// \param items A range of items to enqueue
+        /// \param compare Comparator of the priorities
+        template<QueueItemRange<E, P> R>
+        explicit PairingHeapPriorityQueue(R &&items, const Compare &compare = Compare())
+            : PairingHeapPriorityQueue(compare)
+        {
+            this->EnqueueRange(std::forward<R>(items));
+        }
+
+        PairingHeapPriorityQueue(const PairingHeapPriorityQueue &) = delete;
+
+        /// \brief Move constructor, the nodes and the slabs of the \p queue are taken over in O(1)
+        /// \param queue Queue to move from, which is left empty
+        PairingHeapPriorityQueue(PairingHeapPriorityQueue &&queue) noexcept
+            : PairingHeapPriorityQueue(queue.compare)
+        {
+            this->Meld(queue);
+        }
+
+        PairingHeapPriorityQueue &operator=(const PairingHeapPriorityQueue &) = delete;
+
+        PairingHeapPriorityQueue &operator=(PairingHeapPriorityQueue &&queue) noexcept
+        {
+            if (&queue != this)
+            {
+                this->Clear();
+                this->compare = queue.compare;
+                this->Meld(queue);
+            }
+
+            return *this;
+        }
+
+        /// \brief Destructs the queue freeing up the memory used by the nodes
+        ~PairingHeapPriorityQueue()
+        {
+            this->Clear();
+            delete this->owner;
+        }
+
+        int GetCount() const
+        {
+            return this->count;
+        }
+
+        void Clear()
+        {
+            if constexpr (!std::is_trivially_destructible_v<QueueItem<E, P>>)
+            {
+                this->ForEachNode([this](Node *node)
+                {
+                    this->pool.Deallocate(node);
+                });
+            }
+
+            this->pool.Release();
+            this->root = nullptr;
+            this->count = 0;
+
+            // Żaden węzeł nie wskazuje już tokenów przejętych kolejek
+            if (this->owner != nullptr)
+            {
+                Owner *token = this->owner->next;
+                while (token != nullptr)
+                {
+                    Owner *next = token->next;
+                    delete token;
+                    token = next;
+                }
+
+                this->owner->next = nullptr;
+                this->lastOwner = this->owner;
+            }
+        }
+
+        /// \brief Enqueues the \p element with the given \p priority
+        /// \param element An element to enqueue
+        /// \param priority A priority of the element
+        /// \return A handle to the enqueued item, which stays valid until the item is dequeued or removed
+        Handle Enqueue(E element, P priority)
+        {
+            Owner *token = this->GetOwner();
+            Node *node = this->pool.Allocate(Node{{std::move(element), std::move(priority)}, nullptr, nullptr, nullptr,
+                                                  token});
+            this->root = this->root == nullptr ? node : this->Link(this->root, node);
+            ++this->count;
+            return node;
+        }
+
+        E Dequeue()
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            Node *node = this->root;
+            E element = std::move(node->item.element);
+            this->root = this->MergePairs(node->child);
+            this->Release(node);
+            --this->count;
+            return element;
+        }
+
+        const E &Peek() const
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            return this->root->item.element;
+        }
+
+        void Modify(const E &element, P priority)
+        {
+            Node *found = nullptr;
+            this->ForEachNode([&found, &element](Node *node)
+            {
+                if (found == nullptr && node->item.element == element)
+                {
+                    found = node;
+                }
+            });
+
+            if (found == nullptr)
+            {
+                throw std::runtime_error("Element not found in priority queue.");
+            }
+
+            this->Modify(found, std::move(priority));
+        }
+
+        /// \brief Changes the priority of the item. A raised priority cuts the subtree of the item and links it
+        /// with the root, a lowered one also merges the children of the item into the heap.
+        /// \param handle A handle returned by Enqueue
+        /// \param priority A new priority of the item
+        void Modify(Handle handle, P priority)
+        {
+            this->CheckHandle(handle);
+
+            bool increased = !this->HasHigherPriority(handle->item.priority, priority);
+            handle->item.priority = std::move(priority);
+
+            if (handle == this->root)
+            {
+                if (!increased && handle->child != nullptr)
+                {
+                    Node *children = this->MergePairs(handle->child);
+                    handle->child = nullptr;
+                    this->root = this->Link(handle, children);
+                }
+
+                return;
+            }
+
+            this->Detach(handle);
+            if (!increased && handle->child != nullptr)
+            {
+                Node *children = this->MergePairs(handle->child);
+                handle->child = nullptr;
+                this->root = this->Link(this->root, children);
+            }
+
+            this->root = this->Link(this->root, handle);
+        }
+
+        /// \brief Removes the item from the queue
+        /// \param handle A handle returned by Enqueue, which becomes invalid
+        void Remove(Handle handle)
+        {
+            this->CheckHandle(handle);
+
+            if (handle == this->root)
+            {
+                this->Dequeue();
+                return;
+            }
+
+            this->Detach(handle);
+            if (handle->child != nullptr)
+            {
+                this->root = this->Link(this->root, this->MergePairs(handle->child));
+            }
+
+            this->Release(handle);
+            --this->count;
+        }
+
+        /// \brief Moves all the items of the \p queue to this queue in O(1). The handles of the moved items stay
+        /// valid and refer to this queue. The comparators must order the priorities in the same way; comparators
+        /// with a state are checked, if they can be compared with ==.
+        /// \param queue A queue with the same comparator, which is left empty
+        void Meld(PairingHeapPriorityQueue &queue)
+        {
+            if (&queue == this || queue.root == nullptr)
+            {
+                return;
+            }
+
+            if constexpr (!std::is_empty_v<Compare> && std::equality_comparable<Compare>)
+            {
+                if (!(this->compare == queue.compare))
+                {
+                    throw std::invalid_argument("Comparators of the melded priority queues differ.");
+                }
+            }
+
+            this->pool.Absorb(queue.pool);
+            if (this->owner == nullptr)
+            {
+                this->owner = queue.owner;
+                this->lastOwner = queue.lastOwner;
+            }
+            else
+            {
+                queue.owner->parent = this->owner;
+                queue.lastOwner->next = this->owner->next;
+                this->owner->next = queue.owner;
+                if (this->lastOwner == this->owner)
+                {
+                    this->lastOwner = queue.lastOwner;
+                }
+            }
+
+            queue.owner = queue.lastOwner = nullptr;
+            this->root = this->root == nullptr ? queue.root : this->Link(this->root, queue.root);
+            this->count += queue.count;
+            queue.root = nullptr;
+            queue.count = 0;
+        }
+
+    private:
+        NodePool<Node> pool;
+        Node *root;
+        int count;
+        /// \brief Current token of the queue, followed by the tokens of the melded queues
+        Owner *owner;
+        Owner *lastOwner;
+
+        /// \brief Returns the current token of the queue, creating it with the first node
+        Owner *GetOwner()
+        {
+            if (this->owner == nullptr)
+            {
+                this->owner = this->lastOwner = new Owner{nullptr, nullptr};
+            }
+
+            return this->owner;
+        }
+
+        /// \brief Returns the current token of the queue, which melded the queue of the \p token, shortening
+        /// the path for the next search
+        static Owner *FindOwner(Owner *token)
+        {
+            Owner *current = token;
+            while (current->parent != nullptr)
+            {
+                current = current->parent;
+            }
+
+            while (token != current)
+            {
+                Owner *parent = token->parent;
+                token->parent = current;
+                token = parent;
+            }
+
+            return current;
+        }
+
+        void CheckHandle(Handle handle) const
+        {
+            if (handle == nullptr || handle->owner == nullptr || this->owner == nullptr ||
+                FindOwner(handle->owner) != this->owner)
+            {
+                throw std::runtime_error("Element not found in priority queue.");
+            }
+        }
+
+        /// \brief Returns the \p node to the pool and clears its owner in the released slot, so its stale handle is
+        /// rejected until the slot is reused
+        void Release(Node *node)
+        {
+            auto slot = reinterpret_cast<unsigned char *>(node);
+            std::ptrdiff_t offset = reinterpret_cast<unsigned char *>(&node->owner) - slot;
+            this->pool.Deallocate(node);
+
+            Owner *none = nullptr;
+            std::memcpy(slot + offset, &none, sizeof(none));
+        }
+
+        /// \brief Makes the root with the lower priority the first child of the other one
+        /// \return The root of the linked trees
+        Node *Link(Node *first, Node *second)
+        {
+            if (this->HasHigherPriority(second->item.priority, first->item.priority))
+            {
+                std::swap(first, second);
+            }
+
+            second->sibling = first->child;
+            if (first->child != nullptr)
+            {
+                first->child->previous = second;
+            }
+
+            second->previous = first;
+            first->child = second;
+            first->sibling = first->previous = nullptr;
+            return first;
+        }
+
+        /// \brief Cuts the subtree of the \p node, which is not the root, from its parent
+        void Detach(Node *node)
+        {
+            if (node->previous->child == node)
+            {
+                node->previous->child = node->sibling;
+            }
+            else
+            {
+                node->previous->sibling = node->sibling;
+            }
+
+            if (node->sibling != nullptr)
+            {
+                node->sibling->previous = node->previous;
+            }
+
+            node->sibling = node->previous = nullptr;
+        }
+
+        /// \brief Links the siblings starting at \p first in pairs from left to right, and then links the pairs
+        /// from right to left
+        /// \return The root of the merged tree, or nullptr if there are no siblings
+        Node *MergePairs(Node *first)
+        {
+            Node *pairs = nullptr;
+            while (first != nullptr)
+            {
+                Node *second = first->sibling;
+                if (second == nullptr)
+                {
+                    first->sibling = pairs;
+                    pairs = first;
+                    break;
+                }
+
+                Node *next = second->sibling;
+                Node *pair = this->Link(first, second);
+                pair->sibling = pairs;
+                pairs = pair;
+                first = next;
+            }
+
+            if (pairs == nullptr)
+            {
+                return nullptr;
+            }
+
+            Node *result = pairs;
+            pairs = pairs->sibling;
+            result->sibling = result->previous = nullptr;
+            while (pairs != nullptr)
+            {
+                Node *next = pairs->sibling;
+                result = this->Link(result, pairs);
+                pairs = next;
+            }
+
+            return result;
+        }
+
+        /// \brief Calls the \p function for every node of the heap, the function may release the node
+        template<typename Function>
+        void ForEachNode(Function &&function)
+        {
+            if (this->root == nullptr)
+            {
+                return;
+            }
+
+            DynamicArray<Node *> stack;
+            stack.Add(this->root);
+            while (stack.GetLength() > 0)
+            {
+                Node *node = stack[stack.GetLength() - 1];
+                stack.RemoveLast();
+
+                if (node->sibling != nullptr)
+                {
+                    stack.Add(node->sibling);
+                }
+
+                if (node->child != nullptr)
+                {
+                    stack.Add(node->child);
+                }
+
+                function(node);
+            }
+        }
+    };
+
+} // DataStructures
+
+#endif //PROJECT2_PAIRINGHEAPPRIORITYQUEUE_H
@@ -0,0 +1,244 @@
+#ifndef PROJECT2_PRIORITYKERNELS_H
+#define PROJECT2_PRIORITYKERNELS_H
+
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#if !defined(PROJECT2_NO_SIMD) && (defined(__AVX2__) || defined(__SSE4_1__))
+#include <immintrin.h>
+#endif
+
+namespace DataStructures
+{
+    /// \brief Returns the offset of the first greatest priority in the block of \p count priorities
+    /// \param priorities A pointer to the first priority of the block
+    /// \param count Number of priorities in the block
+    /// \param compare Comparator of the priorities
+    /// \return A zero-based offset of the greatest priority
+    template<typename P, typename Compare>
+    int SelectBestScalar(const P *priorities, int count, const Compare &compare)
+    {
+        int best = 0;
+        for (int i = 1; i < count; ++i)
+        {
+            if (compare(priorities[best], priorities[i]))
+            {
+                best = i;
+            }
+        }
+
+        return best;
+    }
+
+    /// \brief Determines whether the vectorized kernels support the priority type and the comparator
+    template<typename P, typename Compare>
+    constexpr bool IsSimdSelectable = std::is_same_v<P, std::int32_t> &&
+                                      (std::is_same_v<Compare, std::less<P>> || std::is_same_v<Compare, std::greater<P>> ||
+                                       std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::greater<>>);
+
+#if !defined(PROJECT2_NO_SIMD) && defined(__AVX2__)
+    constexpr bool HasSimdKernels = true;
+    constexpr int SimdLanes = 8;
+    using SimdVector = __m256i;
+
+    inline SimdVector LoadSimd(const std::int32_t *priorities)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(priorities));
+    }
+
+    template<bool Maximum>
+    SimdVector PickSimd(SimdVector first, SimdVector second)
+    {
+        return Maximum ? _mm256_max_epi32(first, second) : _mm256_min_epi32(first, second);
+    }
+
+    /// \brief Returns a vector with the greatest lane of the \p vector in every lane
+    template<bool Maximum>
+    SimdVector BroadcastBestSimd(SimdVector vector)
+    {
+        vector = PickSimd<Maximum>(vector, _mm256_permute2x128_si256(vector, vector, 1));
+        vector = PickSimd<Maximum>(vector, _mm256_shuffle_epi32(vector, _MM_SHUFFLE(1, 0, 3, 2)));
+        return PickSimd<Maximum>(vector, _mm256_shuffle_epi32(vector, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+
+    inline unsigned EqualMaskSimd(SimdVector first, SimdVector second)
+    {
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(first, second))));
+    }
+
+    inline std::int32_t FirstLaneSimd(SimdVector vector)
+    {
+        return _mm256_cvtsi256_si32(vector);
+    }
+
+    inline SimdVector BroadcastSimd(std::int32_t value)
+    {
+        return _mm256_set1_epi32(value);
+    }
+#elif !defined(PROJECT2_NO_SIMD) && defined(__SSE4_1__)
+    constexpr bool HasSimdKernels = true;
+    constexpr int SimdLanes = 4;
+    using SimdVector = __m128i;
+
+    inline SimdVector LoadSimd(const std::int32_t *priorities)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(priorities));
+    }
+
+    template<bool Maximum>
+    SimdVector PickSimd(SimdVector first, SimdVector second)
+    {
+        return Maximum ? _mm_max_epi32(first, second) : _mm_min_epi32(first, second);
+    }
+
+    /// \brief Returns a vector with the greatest lane of the \p vector in every lane
+    template<bool Maximum>
+    SimdVector BroadcastBestSimd(SimdVector vector)
+    {
+        vector = PickSimd<Maximum>(vector, _mm_shuffle_epi32(vector, _MM_SHUFFLE(1, 0, 3, 2)));
+        return PickSimd<Maximum>(vector, _mm_shuffle_epi32(vector, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+
+    inline unsigned EqualMaskSimd(SimdVector first, SimdVector second)
+    {
+        return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(first, second))));
+    }
+
+    inline std::int32_t FirstLaneSimd(SimdVector vector)
+    {
+        return _mm_cvtsi128_si32(vector);
+    }
+
+    inline SimdVector BroadcastSimd(std::int32_t value)
+    {
+        return _mm_set1_epi32(value);
+    }
+#else
+    constexpr bool HasSimdKernels = false;
+#endif
+
+#if !defined(PROJECT2_NO_SIMD) && (defined(__AVX2__) || defined(__SSE4_1__))
+    /// \brief Returns the offset of the first greatest of \p Width 32-bit priorities using SIMD instructions
+    template<int Width, bool Maximum>
+    int SelectBestSimd(const std::int32_t *priorities)
+    {
+        static_assert(Width % SimdLanes == 0 && Width <= 32, "Width must be a multiple of the number of lanes");
+        constexpr int Blocks = Width / SimdLanes;
+
+        SimdVector blocks[Blocks];
+        for (int i = 0; i < Blocks; ++i)
+        {
+            blocks[i] = LoadSimd(priorities + SimdLanes * i);
+        }
+
+        SimdVector best = blocks[0];
+        for (int i = 1; i < Blocks; ++i)
+        {
+            best = PickSimd<Maximum>(best, blocks[i]);
+        }
+
+        best = BroadcastBestSimd<Maximum>(best);
+
+        unsigned mask = 0;
+        for (int i = 0; i < Blocks; ++i)
+        {
+            mask |= EqualMaskSimd(blocks[i], best) << (SimdLanes * i);
+        }
+
+        return std::countr_zero(mask);
+    }
+
+    /// \brief Returns the index of the first greatest of \p count 32-bit priorities using SIMD instructions. The first
+    /// pass finds the greatest value, the second one stops at the first block containing it.
+    template<bool Maximum>
+    int FindBestSimd(const std::int32_t *priorities, int count)
+    {
+        std::int32_t best = priorities[0];
+        int i = 0;
+        if (count >= SimdLanes)
+        {
+            SimdVector first = LoadSimd(priorities);
+            SimdVector second = first;
+            for (i = SimdLanes; i + 2 * SimdLanes <= count; i += 2 * SimdLanes)
+            {
+                first = PickSimd<Maximum>(first, LoadSimd(priorities + i));
+                second = PickSimd<Maximum>(second, LoadSimd(priorities + i + SimdLanes));
+            }
+
+            best = FirstLaneSimd(BroadcastBestSimd<Maximum>(PickSimd<Maximum>(first, second)));
+        }
+
+        for (; i < count; ++i)
+        {
+            best = Maximum ? (priorities[i] > best ? priorities[i] : best) : (priorities[i] < best ? priorities[i] : best);
+        }
+
+        SimdVector target = BroadcastSimd(best);
+        int j = 0;
+        for (; j + SimdLanes <= count; j += SimdLanes)
+        {
+            unsigned mask = EqualMaskSimd(LoadSimd(priorities + j), target);
+            if (mask != 0)
+            {
+                return j + std::countr_zero(mask);
+            }
+        }
+
+        while (priorities[j] != best)
+        {
+            ++j;
+        }
+
+        return j;
+    }
+#endif
+
+    /// \brief Returns the offset of the first greatest priority in the block of \p count priorities. Full blocks of
+    /// 8 or 16 32-bit priorities compared with std::less or std::greater are searched with SIMD instructions when
+    /// the compiler targets AVX2 or SSE4.1, other blocks are searched with a scalar loop.
+    /// \tparam Width Size of a full block
+    /// \param priorities A pointer to the first priority of the block
+    /// \param count Number of priorities in the block
+    /// \param compare Comparator of the priorities
+    /// \return A zero-based offset of the greatest priority
+    template<int Width, typename P, typename Compare>
+    int SelectBest(const P *priorities, int count, const Compare &compare)
+    {
+#if !defined(PROJECT2_NO_SIMD) && (defined(__AVX2__) || defined(__SSE4_1__))
+        if constexpr ((Width == 8 || Width == 16) && IsSimdSelectable<P, Compare>)
+        {
+            if (count == Width)
+            {
+                constexpr bool Maximum = std::is_same_v<Compare, std::less<P>> || std::is_same_v<Compare, std::less<>>;
+                return SelectBestSimd<Width, Maximum>(priorities);
+            }
+        }
+#endif
+
+        return SelectBestScalar(priorities, count, compare);
+    }
+
+    /// \brief Returns the index of the first greatest of \p count priorities. Priorities of 32 bits compared with
+    /// std::less or std::greater are searched with SIMD instructions when the compiler targets AVX2 or SSE4.1.
+    /// \param priorities A pointer to the first priority
+    /// \param count Number of priorities, greater than 0
+    /// \param compare Comparator of the priorities
+    /// \return A zero-based index of the greatest priority
+    template<typename P, typename Compare>
+    int FindBest(const P *priorities, int count, const Compare &compare)
+    {
+#if !defined(PROJECT2_NO_SIMD) && (defined(__AVX2__) || defined(__SSE4_1__))
+        if constexpr (IsSimdSelectable<P, Compare>)
+        {
+            constexpr bool Maximum = std::is_same_v<Compare, std::less<P>> || std::is_same_v<Compare, std::less<>>;
+            return FindBestSimd<Maximum>(priorities, count);
+        }
+#endif
+
+        return SelectBestScalar(priorities, count, compare);
+    }
+}
+
+#endif //PROJECT2_PRIORITYKERNELS_H
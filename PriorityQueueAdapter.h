@@ -0,0 +1,79 @@
+#ifndef PROJECT2_PRIORITYQUEUEADAPTER_H
+#define PROJECT2_PRIORITYQUEUEADAPTER_H
+
+#include "IPriorityQueue.h"
+#include "PriorityQueueLike.h"
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Exposes a statically dispatched queue through the virtual IPriorityQueue interface
+    /// \tparam Q Type of the wrapped queue
+    template<PriorityQueueLike Q>
+    class PriorityQueueAdapter : public IPriorityQueue<typename Q::ElementType, typename Q::PriorityType, typename Q::CompareType>
+    {
+    public:
+        using E = typename Q::ElementType;
+        using P = typename Q::PriorityType;
+
+        /// \brief Constructs an adapter over the \p queue
+        /// \param queue A queue to wrap
+        explicit PriorityQueueAdapter(Q queue = Q()) : queue(std::move(queue))
+        {
+        }
+
+        int GetCount() const
+        {
+            return this->queue.GetCount();
+        }
+
+        bool IsEmpty() const
+        {
+            return this->queue.IsEmpty();
+        }
+
+        void Clear()
+        {
+            this->queue.Clear();
+        }
+
+        void Enqueue(E element, P priority)
+        {
+            this->queue.Enqueue(std::move(element), std::move(priority));
+        }
+
+        E Dequeue()
+        {
+            return this->queue.Dequeue();
+        }
+
+        const E &Peek() const
+        {
+            return this->queue.Peek();
+        }
+
+        void Modify(const E &element, P priority)
+        {
+            this->queue.Modify(element, std::move(priority));
+        }
+
+        /// \brief Returns the wrapped queue
+        /// \return A reference to the wrapped queue
+        Q &GetQueue()
+        {
+            return this->queue;
+        }
+
+        /// \brief Returns the wrapped queue
+        /// \return A reference to the wrapped queue
+        const Q &GetQueue() const
+        {
+            return this->queue;
+        }
+
+    private:
+        Q queue;
+    };
+}
+
+#endif //PROJECT2_PRIORITYQUEUEADAPTER_H
@@ -0,0 +1,70 @@
+#ifndef PROJECT2_PRIORITYQUEUEBASE_H
+#define PROJECT2_PRIORITYQUEUEBASE_H
+
+#include "QueueItem.h"
+#include <functional>
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Represents a base of the priority queue implementations, which are statically dispatched
+    /// \tparam Derived Type of the implementing queue
+    /// \tparam E Type of the elements
+    /// \tparam P Type of the priorities
+    /// \tparam Compare Comparator of the priorities, the element with the greatest priority is dequeued first
+    template<typename Derived, typename E, typename P, typename Compare = std::less<P>>
+    class PriorityQueueBase
+    {
+    public:
+        using ElementType = E;
+        using PriorityType = P;
+        using CompareType = Compare;
+
+        /// \brief Determines whether the queue is empty
+        /// \return \a true if the queue has no elements, \a false otherwise
+        bool IsEmpty() const
+        {
+            return this->Self().GetCount() == 0;
+        }
+
+        /// \brief Enqueues all the \p items one by one. The items of an rvalue container are moved.
+        /// \param items A range of items to enqueue
+        template<QueueItemRange<E, P> R>
+        void EnqueueRange(R &&items)
+        {
+            for (auto &&item: items)
+            {
+                QueueItem<E, P> queueItem = ForwardItem<R>(item);
+                this->Self().Enqueue(std::move(queueItem.element), std::move(queueItem.priority));
+            }
+        }
+
+    protected:
+        Compare compare;
+
+        explicit PriorityQueueBase(const Compare &compare) : compare(compare)
+        {
+        }
+
+        /// \brief Determines whether the \p first priority is greater than the \p second one
+        /// \param first A priority to compare
+        /// \param second A priority to compare with
+        /// \return \a true if \p first should be dequeued before \p second, \a false otherwise
+        bool HasHigherPriority(const P &first, const P &second) const
+        {
+            return this->compare(second, first);
+        }
+
+        Derived &Self()
+        {
+            return static_cast<Derived &>(*this);
+        }
+
+        const Derived &Self() const
+        {
+            return static_cast<const Derived &>(*this);
+        }
+    };
+}
+
+#endif //PROJECT2_PRIORITYQUEUEBASE_H
@@ -0,0 +1,26 @@
+#ifndef PROJECT2_PRIORITYQUEUELIKE_H
+#define PROJECT2_PRIORITYQUEUELIKE_H
+
+#include <concepts>
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Describes a priority queue, which can be used by generic algorithms without virtual calls
+    /// \tparam Q Type of the queue
+    template<typename Q>
+    concept PriorityQueueLike = requires(Q queue, const Q constQueue,
+                                         typename Q::ElementType element, typename Q::PriorityType priority)
+    {
+        typename Q::CompareType;
+        { constQueue.GetCount() } -> std::convertible_to<int>;
+        { constQueue.IsEmpty() } -> std::convertible_to<bool>;
+        queue.Clear();
+        queue.Enqueue(std::move(element), std::move(priority));
+        { queue.Dequeue() } -> std::convertible_to<typename Q::ElementType>;
+        { constQueue.Peek() } -> std::convertible_to<const typename Q::ElementType &>;
+        queue.Modify(element, std::move(priority));
+    };
+}
+
+#endif //PROJECT2_PRIORITYQUEUELIKE_H
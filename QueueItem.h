@@ -1,6 +1,10 @@
 #ifndef PROJECT2_QUEUEITEM_H
 #define PROJECT2_QUEUEITEM_H
 
+#include <concepts>
+#include <ranges>
+#include <type_traits>
+
 namespace DataStructures
 {
     template<typename E, typename P>
@@ -9,6 +13,30 @@ namespace DataStructures
         E element;
         P priority;
     };
+
+    /// \brief Describes a range passed as an rvalue, which owns its items, so the items may be moved out of it
+    template<typename R>
+    concept OwningRvalueRange = !std::is_lvalue_reference_v<R> &&
+                                !std::ranges::enable_view<std::remove_cvref_t<R>>;
+
+    /// \brief Type, through which an item of the range \p R is passed to the queue. The items of an owning rvalue
+    /// range are moved, and the items of other ranges are passed as the range yields them.
+    template<typename R>
+    using RangeItemReference = std::conditional_t<OwningRvalueRange<R>, std::ranges::range_rvalue_reference_t<R>,
+                                                  std::ranges::range_reference_t<R> &&>;
+
+    /// \brief Describes a range of items, which can be enqueued in a priority queue at once
+    template<typename R, typename E, typename P>
+    concept QueueItemRange = std::ranges::input_range<R> &&
+                             std::convertible_to<RangeItemReference<R>, QueueItem<E, P>>;
+
+    /// \brief Passes the \p item of the range \p R on, moving it if the range is an owning rvalue
+    /// \param item An item bound by a range-based for loop over the range
+    template<typename R, typename T>
+    RangeItemReference<R> ForwardItem(T &item)
+    {
+        return static_cast<RangeItemReference<R>>(item);
+    }
 }
 
 #endif //PROJECT2_QUEUEITEM_H
@@ -0,0 +1,207 @@
+#ifndef PROJECT2_RADIXHEAPPRIORITYQUEUE_H
+#define PROJECT2_RADIXHEAPPRIORITYQUEUE_H
+
+#include "PriorityQueueBase.h"
+#include "DynamicArray.h"
+#include "QueueItem.h"
+#include <bit>
+#include <concepts>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Represents a radix heap, a monotone priority queue of integral priorities. The element with the lowest
+    /// priority is dequeued first, and no priority lower than the last dequeued one may be enqueued. The items are
+    /// kept in buckets by the highest bit, in which their priority differs from the last dequeued one, so Enqueue
+    /// takes O(1) and Dequeue takes amortized O(log C), where C is the range of the priorities.
+    /// \tparam E Type of the elements
+    /// \tparam P Integral type of the priorities
+    template<typename E = int, std::integral P = int>
+    class RadixHeapPriorityQueue : public PriorityQueueBase<RadixHeapPriorityQueue<E, P>, E, P, std::greater<P>>
+    {
+        using Key = std::make_unsigned_t<P>;
+
+    public:
+        RadixHeapPriorityQueue() : PriorityQueueBase<RadixHeapPriorityQueue<E, P>, E, P, std::greater<P>>(std::greater<P>()),
+                                   count(0), last(0)
+        {
+        }
+
+        /// \brief Constructs a queue containing the \p items
+        /// \param items A range of items to enqueue
+        template<QueueItemRange<E, P> R>
+        explicit RadixHeapPriorityQueue(R &&items) : RadixHeapPriorityQueue()
+        {
+            this->EnqueueRange(std::forward<R>(items));
+        }
+
+        int GetCount() const
+        {
+            return this->count;
+        }
+
+        /// \brief Removes all the elements, after which any priority can be enqueued again
+        void Clear()
+        {
+            for (auto &bucket: this->buckets)
+            {
+                bucket.Clear();
+            }
+
+            this->count = 0;
+            this->last = 0;
+        }
+
+        void Enqueue(E element, P priority)
+        {
+            Key key = ToKey(priority);
+            if (key < this->last)
+            {
+                throw std::invalid_argument("Priority is lower than the last dequeued priority.");
+            }
+
+            this->buckets[this->GetBucket(key)].Add({std::move(element), std::move(priority)});
+            ++this->count;
+        }
+
+        E Dequeue()
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            this->Redistribute();
+
+            auto &bucket = this->buckets[0];
+            E element = std::move(bucket[bucket.GetLength() - 1].element);
+            bucket.RemoveLast();
+            --this->count;
+            return element;
+        }
+
+        const E &Peek() const
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            if (this->buckets[0].GetLength() > 0)
+            {
+                return this->buckets[0][this->buckets[0].GetLength() - 1].element;
+            }
+
+            const auto &bucket = this->buckets[this->GetFirstBucket()];
+            return bucket[this->FindMinimum(bucket)].element;
+        }
+
+        /// \brief Changes the priority of the \p element, which must not be lower than the last dequeued priority
+        /// \param element An element to modify
+        /// \param priority A new priority of the element
+        void Modify(const E &element, P priority)
+        {
+            if (ToKey(priority) < this->last)
+            {
+                throw std::invalid_argument("Priority is lower than the last dequeued priority.");
+            }
+
+            for (auto &bucket: this->buckets)
+            {
+                for (int i = 0; i < bucket.GetLength(); ++i)
+                {
+                    if (bucket[i].element == element)
+                    {
+                        E moved = std::move(bucket[i].element);
+                        bucket[i] = std::move(bucket[bucket.GetLength() - 1]);
+                        bucket.RemoveLast();
+                        --this->count;
+                        this->Enqueue(std::move(moved), std::move(priority));
+                        return;
+                    }
+                }
+            }
+
+            throw std::runtime_error("Element not found in priority queue.");
+        }
+
+    private:
+        static constexpr int BucketCount = std::numeric_limits<Key>::digits + 1;
+
+        DynamicArray<QueueItem<E, P>> buckets[BucketCount];
+        int count;
+        Key last;
+
+        /// \brief Maps the \p priority to an unsigned key of the same order
+        static Key ToKey(P priority)
+        {
+            if constexpr (std::is_signed_v<P>)
+            {
+                return static_cast<Key>(priority) ^ (Key(1) << (std::numeric_limits<Key>::digits - 1));
+            }
+            else
+            {
+                return priority;
+            }
+        }
+
+        int GetBucket(Key key) const
+        {
+            return std::bit_width(static_cast<Key>(key ^ this->last));
+        }
+
+        int GetFirstBucket() const
+        {
+            int index = 0;
+            while (this->buckets[index].GetLength() == 0)
+            {
+                ++index;
+            }
+
+            return index;
+        }
+
+        static int FindMinimum(const DynamicArray<QueueItem<E, P>> &bucket)
+        {
+            int minimum = 0;
+            for (int i = 1; i < bucket.GetLength(); ++i)
+            {
+                if (bucket[i].priority < bucket[minimum].priority)
+                {
+                    minimum = i;
+                }
+            }
+
+            return minimum;
+        }
+
+        /// \brief Refills the first bucket, if it is empty. The lowest priority of the first non-empty bucket
+        /// becomes the last dequeued one, and the items of the bucket move to lower buckets, because their
+        /// priorities share more high bits with it.
+        void Redistribute()
+        {
+            if (this->buckets[0].GetLength() > 0)
+            {
+                return;
+            }
+
+            auto &bucket = this->buckets[this->GetFirstBucket()];
+            this->last = ToKey(bucket[this->FindMinimum(bucket)].priority);
+
+            for (int i = 0; i < bucket.GetLength(); ++i)
+            {
+                int index = this->GetBucket(ToKey(bucket[i].priority));
+                this->buckets[index].Add(std::move(bucket[i]));
+            }
+
+            bucket.Clear();
+        }
+    };
+
+} // DataStructures
+
+#endif //PROJECT2_RADIXHEAPPRIORITYQUEUE_H
@@ -0,0 +1,401 @@
+#ifndef PROJECT2_SKIPLISTPRIORITYQUEUE_H
+#define PROJECT2_SKIPLISTPRIORITYQUEUE_H
+
+#include "PriorityQueueBase.h"
+#include "QueueItem.h"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Represents a priority queue on a skip list sorted in descending order of priorities. Enqueue takes
+    /// expected O(log n), while Dequeue and Peek take the first node of the bottom level in expected O(1). Items with
+    /// equal priorities are dequeued in the order of insertion. The queue can be iterated from the greatest priority
+    /// to the lowest one.
+    /// Every node is a single allocation holding the item followed by its forward pointers. Released nodes are kept
+    /// on a free list of their height and reused by the next node of the same height.
+    /// \tparam E Type of the elements
+    /// \tparam P Type of the priorities
+    /// \tparam Compare Comparator of the priorities, the element with the greatest priority is dequeued first
+    template<typename E = int, typename P = int, typename Compare = std::less<P>>
+    class SkipListPriorityQueue : public PriorityQueueBase<SkipListPriorityQueue<E, P, Compare>, E, P, Compare>
+    {
+        struct Node
+        {
+            Node **next;
+            int height;
+            QueueItem<E, P> item;
+        };
+
+    public:
+        static const int MaxHeight = 16;
+
+        /// \brief Represents a forward iterator over the items of the queue in the order of dequeuing
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = QueueItem<E, P>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const QueueItem<E, P> *;
+            using reference = const QueueItem<E, P> &;
+
+            Iterator() : node(nullptr)
+            {
+            }
+
+            reference operator*() const
+            {
+                return this->node->item;
+            }
+
+            pointer operator->() const
+            {
+                return &this->node->item;
+            }
+
+            Iterator &operator++()
+            {
+                this->node = this->node->next[0];
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator iterator = *this;
+                this->node = this->node->next[0];
+                return iterator;
+            }
+
+            bool operator==(const Iterator &other) const
+            {
+                return this->node == other.node;
+            }
+
+        private:
+            friend class SkipListPriorityQueue;
+
+            const Node *node;
+
+            explicit Iterator(const Node *node) : node(node)
+            {
+            }
+        };
+
+        explicit SkipListPriorityQueue(const Compare &compare = Compare())
+            : PriorityQueueBase<SkipListPriorityQueue<E, P, Compare>, E, P, Compare>(compare), head(), freeNodes(),
+              count(0), height(1), randomState(0x9E3779B97F4A7C15ull)
+        {
+        }
+
+        /// \brief Constructs a queue containing the \p items
+        /// \param items A range of items to enqueue
+        /// \param compare Comparator of the priorities
+        template<QueueItemRange<E, P> R>
+        explicit SkipListPriorityQueue(R &&items, const Compare &compare = Compare())
+            : SkipListPriorityQueue(compare)
+        {
+            this->EnqueueRange(std::forward<R>(items));
+        }
+
+        /// \brief Copy constructor. The items are appended in order, so the copy is built in O(n).
+        /// \param queue Queue to copy from
+        SkipListPriorityQueue(const SkipListPriorityQueue &queue) : SkipListPriorityQueue(queue.compare)
+        {
+            Node **tails[MaxHeight];
+            for (int i = 0; i < MaxHeight; ++i)
+            {
+                tails[i] = &this->head[i];
+            }
+
+            for (const QueueItem<E, P> &item: queue)
+            {
+                Node *node = this->CreateNode(this->RandomHeight(), item);
+                if (node->height > this->height)
+                {
+                    this->height = node->height;
+                }
+
+                for (int i = 0; i < node->height; ++i)
+                {
+                    *tails[i] = node;
+                    tails[i] = &node->next[i];
+                }
+            }
+
+            for (Node **tail: tails)
+            {
+                *tail = nullptr;
+            }
+
+            this->count = queue.count;
+        }
+
+        SkipListPriorityQueue &operator=(SkipListPriorityQueue queue)
+        {
+            std::swap(this->compare, queue.compare);
+            std::swap(this->head, queue.head);
+            std::swap(this->freeNodes, queue.freeNodes);
+            std::swap(this->count, queue.count);
+            std::swap(this->height, queue.height);
+            std::swap(this->randomState, queue.randomState);
+            return *this;
+        }
+
+        /// \brief Destructs the queue freeing up the memory used by the nodes
+        ~SkipListPriorityQueue()
+        {
+            this->Clear();
+            for (Node *&list: this->freeNodes)
+            {
+                while (list != nullptr)
+                {
+                    Node *node = list;
+                    list = node->next[0];
+                    ::operator delete(node, std::align_val_t(alignof(Node)));
+                }
+            }
+        }
+
+        int GetCount() const
+        {
+            return this->count;
+        }
+
+        void Clear()
+        {
+            Node *node = this->head[0];
+            while (node != nullptr)
+            {
+                Node *next = node->next[0];
+                this->ReleaseNode(node);
+                node = next;
+            }
+
+            for (Node *&link: this->head)
+            {
+                link = nullptr;
+            }
+
+            this->count = 0;
+            this->height = 1;
+        }
+
+        void Enqueue(E element, P priority)
+        {
+            Node *node = this->CreateNode(this->RandomHeight(), QueueItem<E, P>{std::move(element), std::move(priority)});
+            this->Link(node);
+            ++this->count;
+        }
+
+        E Dequeue()
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            Node *node = this->head[0];
+            for (int i = 0; i < node->height; ++i)
+            {
+                this->head[i] = node->next[i];
+            }
+
+            E element = std::move(node->item.element);
+            this->ReleaseNode(node);
+            --this->count;
+            return element;
+        }
+
+        const E &Peek() const
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            return this->head[0]->item.element;
+        }
+
+        void Modify(const E &element, P priority)
+        {
+            Node *node = this->head[0];
+            while (node != nullptr && !(node->item.element == element))
+            {
+                node = node->next[0];
+            }
+
+            if (node == nullptr)
+            {
+                throw std::runtime_error("Element not found in priority queue.");
+            }
+
+            this->Unlink(node);
+            node->item.priority = std::move(priority);
+            this->Link(node);
+        }
+
+        /// \brief Removes all the items, whose priorities lie between \p highest and \p lowest inclusive, in
+        /// expected O(log n + k), where k is the number of the removed items
+        /// \param highest The greatest priority of the range
+        /// \param lowest The lowest priority of the range
+        /// \return Number of the removed items
+        int RemoveRange(const P &highest, const P &lowest)
+        {
+            Node **links[MaxHeight];
+            Node **level = this->head;
+            for (int i = this->height - 1; i >= 0; --i)
+            {
+                while (level[i] != nullptr && this->HasHigherPriority(level[i]->item.priority, highest))
+                {
+                    level = level[i]->next;
+                }
+
+                links[i] = &level[i];
+            }
+
+            int removed = 0;
+            Node *node = *links[0];
+            while (node != nullptr && !this->HasHigherPriority(lowest, node->item.priority))
+            {
+                Node *next = node->next[0];
+                for (int i = 0; i < node->height; ++i)
+                {
+                    *links[i] = node->next[i];
+                }
+
+                this->ReleaseNode(node);
+                ++removed;
+                node = next;
+            }
+
+            this->count -= removed;
+            return removed;
+        }
+
+        /// \brief Returns an iterator to the item with the greatest priority
+        Iterator begin() const
+        {
+            return Iterator(this->head[0]);
+        }
+
+        /// \brief Returns an iterator past the item with the lowest priority
+        Iterator end() const
+        {
+            return Iterator();
+        }
+
+    private:
+        static constexpr std::size_t LinksOffset = (sizeof(Node) + alignof(Node *) - 1) / alignof(Node *) * alignof(Node *);
+
+        Node *head[MaxHeight];
+        Node *freeNodes[MaxHeight];
+        int count;
+        int height;
+        std::uint64_t randomState;
+
+        /// \brief Draws the height of a new node, each level is present with the probability of 1/4
+        int RandomHeight()
+        {
+            this->randomState ^= this->randomState << 13;
+            this->randomState ^= this->randomState >> 7;
+            this->randomState ^= this->randomState << 17;
+
+            int height = 1;
+            std::uint64_t bits = this->randomState;
+            while ((bits & 3) == 0 && height < MaxHeight)
+            {
+                ++height;
+                bits >>= 2;
+            }
+
+            return height;
+        }
+
+        /// \brief Takes a node of the given \p height from the free list or allocates a new one, and constructs
+        /// the \p item in it
+        Node *CreateNode(int height, QueueItem<E, P> item)
+        {
+            Node *node = this->freeNodes[height - 1];
+            if (node != nullptr)
+            {
+                this->freeNodes[height - 1] = node->next[0];
+            }
+            else
+            {
+                auto memory = static_cast<unsigned char *>(::operator new(LinksOffset + height * sizeof(Node *),
+                                                                           std::align_val_t(alignof(Node))));
+                node = reinterpret_cast<Node *>(memory);
+                node->next = reinterpret_cast<Node **>(memory + LinksOffset);
+                node->height = height;
+            }
+
+            std::construct_at(&node->item, std::move(item));
+            return node;
+        }
+
+        /// \brief Destroys the item of the \p node and puts the node on the free list of its height
+        void ReleaseNode(Node *node)
+        {
+            std::destroy_at(&node->item);
+            node->next[0] = this->freeNodes[node->height - 1];
+            this->freeNodes[node->height - 1] = node;
+        }
+
+        /// \brief Inserts the \p node after all the nodes with greater or equal priorities
+        void Link(Node *node)
+        {
+            if (node->height > this->height)
+            {
+                this->height = node->height;
+            }
+
+            Node **level = this->head;
+            for (int i = this->height - 1; i >= 0; --i)
+            {
+                while (level[i] != nullptr && !this->HasHigherPriority(node->item.priority, level[i]->item.priority))
+                {
+                    level = level[i]->next;
+                }
+
+                if (i < node->height)
+                {
+                    node->next[i] = level[i];
+                    level[i] = node;
+                }
+            }
+        }
+
+        /// \brief Detaches the \p node from every level it belongs to. The search descends to the last node with
+        /// a greater priority and then walks along the equal priorities up to the \p node.
+        void Unlink(Node *node)
+        {
+            Node **level = this->head;
+            for (int i = this->height - 1; i >= 0; --i)
+            {
+                while (level[i] != nullptr && this->HasHigherPriority(level[i]->item.priority, node->item.priority))
+                {
+                    level = level[i]->next;
+                }
+
+                if (i < node->height)
+                {
+                    while (level[i] != node)
+                    {
+                        level = level[i]->next;
+                    }
+
+                    level[i] = node->next[i];
+                }
+            }
+        }
+    };
+
+} // DataStructures
+
+#endif //PROJECT2_SKIPLISTPRIORITYQUEUE_H
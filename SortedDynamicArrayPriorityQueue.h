@@ -0,0 +1,135 @@
+#ifndef PROJECT2_SORTEDDYNAMICARRAYPRIORITYQUEUE_H
+#define PROJECT2_SORTEDDYNAMICARRAYPRIORITYQUEUE_H
+
+#include "PriorityQueueBase.h"
+#include "DynamicArray.h"
+#include "QueueItem.h"
+#include <stdexcept>
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Represents a priority queue on a dynamic array sorted in ascending order of priorities. The element with
+    /// the greatest priority is kept at the end of the array, so Peek and Dequeue are O(1), while Enqueue finds the
+    /// position with a binary search and shifts the following items.
+    /// \tparam E Type of the elements
+    /// \tparam P Type of the priorities
+    /// \tparam Compare Comparator of the priorities, the element with the greatest priority is dequeued first
+    template<typename E = int, typename P = int, typename Compare = std::less<P>>
+    class SortedDynamicArrayPriorityQueue
+        : public PriorityQueueBase<SortedDynamicArrayPriorityQueue<E, P, Compare>, E, P, Compare>
+    {
+    public:
+        explicit SortedDynamicArrayPriorityQueue(const Compare &compare = Compare())
+            : PriorityQueueBase<SortedDynamicArrayPriorityQueue<E, P, Compare>, E, P, Compare>(compare)
+        {
+        }
+
+        /// \brief Constructs a queue containing the \p items
+        /// \param items A range of items to enqueue
+        /// \param compare Comparator of the priorities
+        template<QueueItemRange<E, P> R>
+        explicit SortedDynamicArrayPriorityQueue(R &&items, const Compare &compare = Compare())
+            : SortedDynamicArrayPriorityQueue(compare)
+        {
+            this->EnqueueRange(std::forward<R>(items));
+        }
+
+        int GetCount() const
+        {
+            return this->priorities.GetLength();
+        }
+
+        void Clear()
+        {
+            this->priorities.Clear();
+            this->elements.Clear();
+        }
+
+        void Enqueue(E element, P priority)
+        {
+            int index = this->FindPosition(priority);
+            this->InsertAt(index, std::move(element), std::move(priority));
+        }
+
+        E Dequeue()
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            E element = std::move(this->elements[this->GetCount() - 1]);
+            this->priorities.RemoveLast();
+            this->elements.RemoveLast();
+            return element;
+        }
+
+        const E &Peek() const
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            return this->elements[this->GetCount() - 1];
+        }
+
+        void Modify(const E &element, P priority)
+        {
+            int index = this->elements.IndexOf(element);
+            if (index == -1)
+            {
+                throw std::runtime_error("Element not found in priority queue.");
+            }
+
+            E item = std::move(this->elements[index]);
+            this->priorities.RemoveAt(index);
+            this->elements.RemoveAt(index);
+            this->Enqueue(std::move(item), std::move(priority));
+        }
+
+    private:
+        DynamicArray<P> priorities;
+        DynamicArray<E> elements;
+
+        /// \brief Finds the index of the first priority, which is not lower than the \p priority. Inserting there
+        /// keeps the elements of equal priorities in the order they were enqueued.
+        int FindPosition(const P &priority) const
+        {
+            int low = 0;
+            int high = this->GetCount();
+            while (low < high)
+            {
+                int middle = low + (high - low) / 2;
+                if (this->HasHigherPriority(priority, this->priorities[middle]))
+                {
+                    low = middle + 1;
+                }
+                else
+                {
+                    high = middle;
+                }
+            }
+
+            return low;
+        }
+
+        void InsertAt(int index, E &&element, P &&priority)
+        {
+            if (index == this->GetCount())
+            {
+                this->priorities.Add(std::move(priority));
+                this->elements.Add(std::move(element));
+            }
+            else
+            {
+                this->priorities.Insert(index, std::move(priority));
+                this->elements.Insert(index, std::move(element));
+            }
+        }
+    };
+
+} // DataStructures
+
+#endif //PROJECT2_SORTEDDYNAMICARRAYPRIORITYQUEUE_H
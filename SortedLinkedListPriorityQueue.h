@@ -0,0 +1,216 @@
+#ifndef PROJECT2_SORTEDLINKEDLISTPRIORITYQUEUE_H
+#define PROJECT2_SORTEDLINKEDLISTPRIORITYQUEUE_H
+
+#include "PriorityQueueBase.h"
+#include "LinkedList.h"
+#include "QueueItem.h"
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Represents a priority queue on a circular doubly-linked list sorted in descending order of priorities.
+    /// The element with the greatest priority is kept at the head of the list, so Peek and Dequeue are O(1), while
+    /// Enqueue searches for the position from the end of the list closer to the new priority. Items with equal
+    /// priorities are dequeued in the order of insertion. Enqueue returns a handle to the node of the item, which
+    /// stays valid until the item is dequeued or removed.
+    /// \tparam E Type of the elements
+    /// \tparam P Type of the priorities
+    /// \tparam Compare Comparator of the priorities, the element with the greatest priority is dequeued first
+    template<typename E = int, typename P = int, typename Compare = std::less<P>>
+    class SortedLinkedListPriorityQueue
+        : public PriorityQueueBase<SortedLinkedListPriorityQueue<E, P, Compare>, E, P, Compare>
+    {
+    public:
+        using Handle = LinkedListNode<QueueItem<E, P>> *;
+
+        explicit SortedLinkedListPriorityQueue(const Compare &compare = Compare())
+            : PriorityQueueBase<SortedLinkedListPriorityQueue<E, P, Compare>, E, P, Compare>(compare)
+        {
+        }
+
+        /// \brief Constructs a queue containing the \p items
+        /// \param items A range of items to enqueue
+        /// \param compare Comparator of the priorities
+        template<QueueItemRange<E, P> R>
+        explicit SortedLinkedListPriorityQueue(R &&items, const Compare &compare = Compare())
+            : SortedLinkedListPriorityQueue(compare)
+        {
+            this->EnqueueRange(std::forward<R>(items));
+        }
+
+        int GetCount() const
+        {
+            return this->elements.GetCount();
+        }
+
+        void Clear()
+        {
+            this->elements.Clear();
+        }
+
+        /// \brief Enqueues the \p element with the given \p priority after all the items with the same priority
+        /// \param element An element to enqueue
+        /// \param priority A priority of the element
+        /// \return A handle to the enqueued item
+        Handle Enqueue(E element, P priority)
+        {
+            auto predecessor = this->FindPredecessor(priority, nullptr);
+            if (predecessor == nullptr)
+            {
+                this->elements.AddFirst({std::move(element), std::move(priority)});
+                return this->elements.GetFirst();
+            }
+
+            this->elements.AddAfter(predecessor, {std::move(element), std::move(priority)});
+            return predecessor->GetNext();
+        }
+
+        E Dequeue()
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            E element = std::move(this->elements.GetFirst()->GetValue().element);
+            this->elements.RemoveFirst();
+            return element;
+        }
+
+        const E &Peek() const
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            return this->elements.GetFirst()->GetValue().element;
+        }
+
+        void Modify(const E &element, P priority)
+        {
+            auto node = this->elements.GetFirst();
+            for (int i = 0; i < this->elements.GetCount(); i++)
+            {
+                if (node->GetValue().element == element)
+                {
+                    this->Modify(node, std::move(priority));
+                    return;
+                }
+
+                node = node->GetNext();
+            }
+
+            throw std::runtime_error("Element not found in priority queue.");
+        }
+
+        /// \brief Changes the priority of the item and moves its node to the new position, after all the items
+        /// with the same priority. The handle stays valid.
+        /// \param handle A handle returned by Enqueue
+        /// \param priority A new priority of the item
+        void Modify(Handle handle, P priority)
+        {
+            this->CheckHandle(handle);
+
+            auto predecessor = this->FindPredecessor(priority, handle);
+            handle->GetValue().priority = std::move(priority);
+            if (predecessor == nullptr)
+            {
+                this->elements.MoveFirst(handle);
+            }
+            else
+            {
+                this->elements.MoveAfter(handle, predecessor);
+            }
+        }
+
+        /// \brief Removes the item from the queue in O(1)
+        /// \param handle A handle returned by Enqueue, which becomes invalid
+        void Remove(Handle handle)
+        {
+            this->CheckHandle(handle);
+            this->elements.RemoveNode(handle);
+        }
+
+    private:
+        LinkedList<QueueItem<E, P>> elements;
+
+        void CheckHandle(Handle handle) const
+        {
+            if (handle == nullptr || handle->GetList() != &this->elements)
+            {
+                throw std::runtime_error("Element not found in priority queue.");
+            }
+        }
+
+        /// \brief Determines whether the position of the \p priority should be searched for from the head. Arithmetic
+        /// priorities are compared with the priorities at both ends, other ones are searched for from the tail,
+        /// unless they belong before the head.
+        bool IsCloserToHead(const P &priority) const
+        {
+            const P &first = this->elements.GetFirst()->GetValue().priority;
+            if constexpr (std::is_arithmetic_v<P>)
+            {
+                const P &last = this->elements.GetLast()->GetValue().priority;
+                return std::abs(static_cast<double>(first) - static_cast<double>(priority)) <
+                       std::abs(static_cast<double>(priority) - static_cast<double>(last));
+            }
+            else
+            {
+                return this->HasHigherPriority(priority, first);
+            }
+        }
+
+        /// \brief Finds the last node, whose priority is not lower than the \p priority, skipping the \p ignored node
+        /// \return The node after which the item belongs, or nullptr if it belongs at the head
+        Handle FindPredecessor(const P &priority, const LinkedListNode<QueueItem<E, P>> *ignored)
+        {
+            int count = this->elements.GetCount();
+            if (count == 0)
+            {
+                return nullptr;
+            }
+
+            if (this->IsCloserToHead(priority))
+            {
+                Handle predecessor = nullptr;
+                auto node = this->elements.GetFirst();
+                for (int i = 0; i < count; i++)
+                {
+                    if (node != ignored)
+                    {
+                        if (this->HasHigherPriority(priority, node->GetValue().priority))
+                        {
+                            break;
+                        }
+
+                        predecessor = node;
+                    }
+
+                    node = node->GetNext();
+                }
+
+                return predecessor;
+            }
+
+            auto node = this->elements.GetLast();
+            for (int i = 0; i < count; i++)
+            {
+                if (node != ignored && !this->HasHigherPriority(priority, node->GetValue().priority))
+                {
+                    return node;
+                }
+
+                node = node->GetPrevious();
+            }
+
+            return nullptr;
+        }
+    };
+
+} // DataStructures
+
+#endif //PROJECT2_SORTEDLINKEDLISTPRIORITYQUEUE_H
@@ -0,0 +1,68 @@
+#ifndef PROJECT2_SPINLOCK_H
+#define PROJECT2_SPINLOCK_H
+
+#include <atomic>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace DataStructures
+{
+    /// \brief Represents a test-and-test-and-set spin lock. A waiting thread spins on a read of the flag, and
+    /// yields its time slice after a number of unsuccessful spins. The lock meets the Lockable requirements,
+    /// so it can be used with std::lock_guard and std::unique_lock.
+    class SpinLock
+    {
+    public:
+        static const int SpinCount = 64;
+
+        SpinLock() = default;
+
+        SpinLock(const SpinLock &) = delete;
+
+        SpinLock &operator=(const SpinLock &) = delete;
+
+        void lock()
+        {
+            while (this->flag.exchange(true, std::memory_order_acquire))
+            {
+                int spins = 0;
+                while (this->flag.load(std::memory_order_relaxed))
+                {
+                    if (++spins < SpinCount)
+                    {
+                        Pause();
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        }
+
+        bool try_lock()
+        {
+            return !this->flag.load(std::memory_order_relaxed) && !this->flag.exchange(true, std::memory_order_acquire);
+        }
+
+        void unlock()
+        {
+            this->flag.store(false, std::memory_order_release);
+        }
+
+    private:
+        std::atomic<bool> flag = false;
+
+        static void Pause()
+        {
+#if defined(__SSE2__) || defined(_M_X64)
+            _mm_pause();
+#endif
+        }
+    };
+}
+
+#endif //PROJECT2_SPINLOCK_H
@@ -0,0 +1,104 @@
+#ifndef PROJECT2_THREADSLOTS_H
+#define PROJECT2_THREADSLOTS_H
+
+#include "CacheAlignedAllocator.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace DataStructures
+{
+    /// \brief Represents a fixed array of per-thread records. Every thread takes the next free record on its first
+    /// call of GetSlot and keeps it until the array is destroyed, so the records taken so far are always the first
+    /// GetUsedCount ones. Every record occupies its own cache lines.
+    /// \tparam T Type of the records, default constructible
+    /// \tparam Count Maximum number of the threads
+    template<typename T, int Count>
+    class ThreadSlots
+    {
+        struct alignas(CacheLineSize) Entry
+        {
+            std::atomic<std::thread::id> owner;
+            T value;
+        };
+
+    public:
+        ThreadSlots() : entries(std::make_unique<Entry[]>(Count)), usedCount(0), id(NextId())
+        {
+        }
+
+        ThreadSlots(const ThreadSlots &) = delete;
+
+        ThreadSlots &operator=(const ThreadSlots &) = delete;
+
+        /// \brief Returns the number of the records taken so far
+        int GetUsedCount() const
+        {
+            int count = this->usedCount.load(std::memory_order_acquire);
+            return count < Count ? count : Count;
+        }
+
+        T &operator[](int index)
+        {
+            return this->entries[index].value;
+        }
+
+        const T &operator[](int index) const
+        {
+            return this->entries[index].value;
+        }
+
+        /// \brief Returns the record of the calling thread, taking a free one on the first call
+        T &GetSlot()
+        {
+            thread_local std::uint64_t cachedId = 0;
+            thread_local T *cachedSlot = nullptr;
+            if (cachedId == this->id)
+            {
+                return *cachedSlot;
+            }
+
+            std::thread::id thread = std::this_thread::get_id();
+            T *slot = nullptr;
+            for (int i = 0; i < this->GetUsedCount() && slot == nullptr; ++i)
+            {
+                if (this->entries[i].owner.load() == thread)
+                {
+                    slot = &this->entries[i].value;
+                }
+            }
+
+            if (slot == nullptr)
+            {
+                int index = this->usedCount.fetch_add(1);
+                if (index >= Count)
+                {
+                    throw std::runtime_error("Too many threads use the per-thread slots.");
+                }
+
+                this->entries[index].owner.store(thread);
+                slot = &this->entries[index].value;
+            }
+
+            // Pamięć podręczna jest jedna na wątek, więc przełączanie między tablicami wymaga ponownego szukania
+            cachedId = this->id;
+            cachedSlot = slot;
+            return *slot;
+        }
+
+    private:
+        std::unique_ptr<Entry[]> entries;
+        std::atomic<int> usedCount;
+        std::uint64_t id;
+
+        static std::uint64_t NextId()
+        {
+            static std::atomic<std::uint64_t> nextId = 0;
+            return ++nextId;
+        }
+    };
+}
+
+#endif //PROJECT2_THREADSLOTS_H
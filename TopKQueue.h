@@ -0,0 +1,174 @@
+#ifndef PROJECT2_TOPKQUEUE_H
+#define PROJECT2_TOPKQUEUE_H
+
+#include "PriorityQueueBase.h"
+#include "DynamicArray.h"
+#include "QueueItem.h"
+#include <stdexcept>
+#include <utility>
+
+namespace DataStructures
+{
+    /// \brief Represents a bounded queue, which keeps the K items with the greatest priorities. The kept items form
+    /// a binary heap with the lowest priority at the root, so an item not better than the threshold is rejected in
+    /// O(1), and a better one replaces the root in O(log K). The memory for K items is reserved once.
+    /// \tparam E Type of the elements
+    /// \tparam P Type of the priorities
+    /// \tparam Compare Comparator of the priorities, the items with the greatest priorities are kept
+    template<typename E = int, typename P = int, typename Compare = std::less<P>>
+    class TopKQueue : public PriorityQueueBase<TopKQueue<E, P, Compare>, E, P, Compare>
+    {
+    public:
+        /// \brief Constructs an empty queue keeping at most \p capacity items
+        /// \param capacity Number of the kept items, greater than 0
+        /// \param compare Comparator of the priorities
+        explicit TopKQueue(int capacity, const Compare &compare = Compare())
+            : PriorityQueueBase<TopKQueue<E, P, Compare>, E, P, Compare>(compare), items(capacity), capacity(capacity)
+        {
+            if (capacity <= 0)
+            {
+                throw std::invalid_argument("Capacity must be positive.");
+            }
+        }
+
+        int GetCount() const
+        {
+            return this->items.GetLength();
+        }
+
+        /// \brief Returns the maximum number of the kept items
+        /// \return Number K of the kept items
+        int GetCapacity() const
+        {
+            return this->capacity;
+        }
+
+        /// \brief Determines whether the queue keeps K items already
+        /// \return \a true if an enqueued item must beat the threshold, \a false otherwise
+        bool IsFull() const
+        {
+            return this->GetCount() == this->capacity;
+        }
+
+        void Clear()
+        {
+            this->items.Clear();
+        }
+
+        /// \brief Returns the lowest priority of the kept items, which a new item must exceed when the queue is full
+        /// \return The lowest kept priority
+        const P &GetThreshold() const
+        {
+            if (this->IsEmpty())
+            {
+                throw std::exception();
+            }
+
+            return this->items[0].priority;
+        }
+
+        /// \brief Keeps the \p element, if the queue is not full or the \p priority exceeds the threshold. In the
+        /// latter case the item with the lowest priority is evicted.
+        /// \param element An element to enqueue
+        /// \param priority A priority of the element
+        /// \return \a true if the element was kept, \a false if it was rejected
+        bool Enqueue(E element, P priority)
+        {
+            if (!this->IsFull())
+            {
+                this->items.Add({std::move(element), std::move(priority)});
+                this->HeapifyUp(this->GetCount() - 1);
+                return true;
+            }
+
+            if (!this->HasHigherPriority(priority, this->items[0].priority))
+            {
+                return false;
+            }
+
+            this->items[0] = {std::move(element), std::move(priority)};
+            this->HeapifyDown(0, this->GetCount());
+            return true;
+        }
+
+        /// \brief Sorts the kept items in place from the greatest priority to the lowest one and moves them into
+        /// the \p result, leaving the queue empty. The queue keeps its memory, and the \p result reallocates only
+        /// if its capacity is lower than the number of the kept items, so reusing the same \p result in every
+        /// cycle allocates nothing.
+        /// \param result An array replaced with the kept items in the order of descending priorities
+        void ExtractSorted(DynamicArray<QueueItem<E, P>> &result)
+        {
+            for (int last = this->GetCount() - 1; last > 0; --last)
+            {
+                std::swap(this->items[0], this->items[last]);
+                this->HeapifyDown(0, last);
+            }
+
+            result.Clear();
+            result.Reserve(this->GetCount());
+            for (QueueItem<E, P> &item: this->items)
+            {
+                result.Add(std::move(item));
+            }
+
+            this->items.Clear();
+        }
+
+    private:
+        DynamicArray<QueueItem<E, P>> items;
+        int capacity;
+
+        /// \brief Determines whether the item at \p first should be closer to the root than the item at \p second
+        bool IsWorse(int first, int second) const
+        {
+            return this->HasHigherPriority(this->items[second].priority, this->items[first].priority);
+        }
+
+        void HeapifyUp(int index)
+        {
+            while (index > 0)
+            {
+                int parent = (index - 1) / 2;
+                if (!this->IsWorse(index, parent))
+                {
+                    break;
+                }
+
+                std::swap(this->items[index], this->items[parent]);
+                index = parent;
+            }
+        }
+
+        /// \brief Moves the item at the \p index down the heap made of the first \p count items
+        void HeapifyDown(int index, int count)
+        {
+            while (true)
+            {
+                int worst = index;
+                int left = 2 * index + 1;
+                int right = left + 1;
+
+                if (left < count && this->IsWorse(left, worst))
+                {
+                    worst = left;
+                }
+
+                if (right < count && this->IsWorse(right, worst))
+                {
+                    worst = right;
+                }
+
+                if (worst == index)
+                {
+                    break;
+                }
+
+                std::swap(this->items[index], this->items[worst]);
+                index = worst;
+            }
+        }
+    };
+
+} // DataStructures
+
+#endif //PROJECT2_TOPKQUEUE_H
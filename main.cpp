@@ -1,6 +1,13 @@
-#include <iostream>
+#include "Benchmarks.h"
 
 int main()
 {
+    Benchmarks::ChildSelection();
+    Benchmarks::HeapDequeue();
+    Benchmarks::MaxScan();
+    Benchmarks::ArrayQueueDequeue();
+    Benchmarks::MonotoneQueue();
+    Benchmarks::ConcurrentQueue();
+    Benchmarks::RelaxedQueue();
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,215 @@
+#include "BlockingPriorityQueue.h"
+#include "HeapPriorityQueue.h"
+#include "StressTest.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    using Queue = DataStructures::BlockingPriorityQueue<DataStructures::HeapPriorityQueue<int, int>>;
+
+    /// \brief Runs producers and consumers on a queue of a small capacity, so the producers block, and checks that
+    /// every item is dequeued exactly once and the queue never holds more items than its capacity
+    void CheckBoundedCapacity()
+    {
+        const int producerCount = 4;
+        const int consumerCount = 4;
+        const int perProducer = 5000;
+        const int capacity = 8;
+        const int total = producerCount * perProducer;
+
+        Queue queue(capacity);
+        auto seen = std::make_unique<std::atomic<int>[]>(total);
+        std::atomic<int> dequeued = 0;
+
+        DataStructures::DynamicArray<std::thread> threads(producerCount + consumerCount);
+        for (int i = 0; i < producerCount; ++i)
+        {
+            threads.Emplace([&](int producer)
+            {
+                for (int i = 0; i < perProducer; ++i)
+                {
+                    int element = producer * perProducer + i;
+                    queue.Enqueue(element, StressTest::PriorityOf(element));
+                }
+            }, i);
+        }
+
+        for (int i = 0; i < consumerCount; ++i)
+        {
+            threads.Emplace([&]()
+            {
+                while (true)
+                {
+                    int element;
+                    try
+                    {
+                        element = queue.Dequeue();
+                    }
+                    catch (const std::runtime_error &)
+                    {
+                        return;
+                    }
+
+                    StressTest::Require(element >= 0 && element < total, "dequeued element was enqueued");
+                    StressTest::Require(seen[element].fetch_add(1) == 0, "element dequeued once");
+                    StressTest::Require(queue.GetCount() <= capacity, "queue does not exceed its capacity");
+                    dequeued.fetch_add(1);
+                }
+            });
+        }
+
+        for (int i = 0; i < producerCount; ++i)
+        {
+            threads[i].join();
+        }
+
+        // Konsumenci kończą, gdy zamknięta kolejka zostanie opróżniona
+        queue.Close();
+        for (int i = producerCount; i < producerCount + consumerCount; ++i)
+        {
+            threads[i].join();
+        }
+
+        StressTest::Require(dequeued.load() == total, "every element dequeued");
+        StressTest::Require(queue.IsEmpty(), "queue is empty after closing");
+    }
+
+    void CheckTimeout()
+    {
+        Queue queue;
+        auto timeout = std::chrono::milliseconds(20);
+        auto start = std::chrono::steady_clock::now();
+        int element;
+        StressTest::Require(!queue.TryDequeueFor(element, timeout), "TryDequeueFor fails on an empty queue");
+        StressTest::Require(std::chrono::steady_clock::now() - start >= timeout, "TryDequeueFor waits the timeout");
+        StressTest::Require(!queue.TryDequeue(element), "TryDequeue fails on an empty queue");
+
+        Queue full(1);
+        StressTest::Require(full.TryEnqueue(1, 1), "TryEnqueue succeeds below the capacity");
+        StressTest::Require(!full.TryEnqueueFor(2, 2, timeout), "TryEnqueueFor fails on a full queue");
+    }
+
+    /// \brief Checks that Close wakes up the producers waiting on a full queue and the consumers waiting on
+    /// an empty one
+    void CheckCloseWakesUp()
+    {
+        const int threadCount = 4;
+
+        Queue empty;
+        Queue full(1);
+        full.Enqueue(0, 0);
+        std::atomic<int> woken = 0;
+
+        DataStructures::DynamicArray<std::thread> threads(2 * threadCount);
+        for (int i = 0; i < threadCount; ++i)
+        {
+            threads.Emplace([&]()
+            {
+                try
+                {
+                    empty.Dequeue();
+                }
+                catch (const std::runtime_error &)
+                {
+                    woken.fetch_add(1);
+                }
+            });
+            threads.Emplace([&](int element)
+            {
+                try
+                {
+                    full.Enqueue(element, element);
+                }
+                catch (const std::runtime_error &)
+                {
+                    woken.fetch_add(1);
+                }
+            }, i + 1);
+        }
+
+        // Wątki zdążą zasnąć, ale test jest poprawny także wtedy, gdy Close je wyprzedzi
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        empty.Close();
+        full.Close();
+        for (std::thread &thread: threads)
+        {
+            thread.join();
+        }
+
+        StressTest::Require(woken.load() == 2 * threadCount, "Close wakes up every waiting thread");
+        StressTest::Require(full.GetCount() == 1 && full.Dequeue() == 0, "closed queue keeps its item");
+    }
+
+    /// \brief Checks that the items enqueued before Close are dequeued in order, and Dequeue throws only once
+    /// the closed queue is empty
+    void CheckDrainAfterClose()
+    {
+        const int count = 100;
+
+        Queue queue;
+        for (int i = 0; i < count; ++i)
+        {
+            queue.Enqueue(i, i);
+        }
+
+        queue.Close();
+        StressTest::Require(queue.IsClosed(), "queue is closed");
+
+        bool enqueueThrown = false;
+        try
+        {
+            queue.Enqueue(count, count);
+        }
+        catch (const std::runtime_error &)
+        {
+            enqueueThrown = true;
+        }
+
+        StressTest::Require(enqueueThrown, "Enqueue throws after Close");
+        for (int i = count - 1; i >= 0; --i)
+        {
+            StressTest::Require(queue.Dequeue() == i, "remaining items are dequeued in order after Close");
+        }
+
+        bool dequeueThrown = false;
+        try
+        {
+            queue.Dequeue();
+        }
+        catch (const std::runtime_error &)
+        {
+            dequeueThrown = true;
+        }
+
+        StressTest::Require(dequeueThrown, "Dequeue throws once the closed queue is empty");
+        int element;
+        StressTest::Require(!queue.TryDequeueFor(element, std::chrono::seconds(1)),
+                            "TryDequeueFor fails on a closed empty queue");
+    }
+}
+
+int main()
+{
+    const int threadCount = 8;
+    const int perThread = 5000;
+
+    for (int round = 0; round < 2; ++round)
+    {
+        Queue queue;
+        StressTest::Run(queue, threadCount, perThread);
+    }
+
+    for (int round = 0; round < 2; ++round)
+    {
+        CheckBoundedCapacity();
+    }
+
+    CheckTimeout();
+    CheckCloseWakesUp();
+    CheckDrainAfterClose();
+    return 0;
+}
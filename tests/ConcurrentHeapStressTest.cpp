@@ -0,0 +1,16 @@
+#include "ConcurrentHeapPriorityQueue.h"
+#include "StressTest.h"
+
+int main()
+{
+    const int threadCount = 8;
+    const int perThread = 10000;
+
+    for (int round = 0; round < 4; ++round)
+    {
+        DataStructures::ConcurrentHeapPriorityQueue<int, int> queue(threadCount * perThread);
+        StressTest::Run(queue, threadCount, perThread);
+    }
+
+    return 0;
+}
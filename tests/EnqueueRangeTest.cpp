@@ -0,0 +1,75 @@
+#include "DynamicArrayPriorityQueue.h"
+#include "HeapPriorityQueue.h"
+#include "LinkedListPriorityQueue.h"
+#include "MinMaxHeapPriorityQueue.h"
+#include "PairingHeapPriorityQueue.h"
+#include "QueueItem.h"
+#include "RadixHeapPriorityQueue.h"
+#include "SkipListPriorityQueue.h"
+#include "SortedDynamicArrayPriorityQueue.h"
+#include "SortedLinkedListPriorityQueue.h"
+#include "StressTest.h"
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using Item = DataStructures::QueueItem<std::unique_ptr<int>, int>;
+
+    std::vector<Item> MoveOnlyItems(int first, int count)
+    {
+        std::vector<Item> items;
+        for (int i = first; i < first + count; ++i)
+        {
+            items.push_back({std::make_unique<int>(i), i});
+        }
+
+        return items;
+    }
+
+    /// \brief Constructs the queue from an rvalue vector of move-only items and enqueues another one, then checks
+    /// that the vectors were moved from and every item is dequeued once
+    template<typename Queue>
+    void CheckMoveOnlyRange()
+    {
+        const int count = 100;
+
+        std::vector<Item> constructed = MoveOnlyItems(0, count);
+        std::vector<Item> enqueued = MoveOnlyItems(count, count);
+        Queue queue(std::move(constructed));
+        queue.EnqueueRange(std::move(enqueued));
+
+        for (int i = 0; i < count; ++i)
+        {
+            StressTest::Require(constructed[i].element == nullptr && enqueued[i].element == nullptr,
+                                "items of an rvalue vector are moved");
+        }
+
+        StressTest::Require(queue.GetCount() == 2 * count, "every item is enqueued");
+        long long sum = 0;
+        while (!queue.IsEmpty())
+        {
+            std::unique_ptr<int> element = queue.Dequeue();
+            StressTest::Require(element != nullptr, "dequeued element is not empty");
+            sum += *element;
+        }
+
+        StressTest::Require(sum == 2LL * count * (2 * count - 1) / 2, "every item is dequeued once");
+    }
+}
+
+int main()
+{
+    CheckMoveOnlyRange<DataStructures::DynamicArrayPriorityQueue<std::unique_ptr<int>, int>>();
+    CheckMoveOnlyRange<DataStructures::HeapPriorityQueue<std::unique_ptr<int>, int>>();
+    CheckMoveOnlyRange<DataStructures::HeapPriorityQueue<std::unique_ptr<int>, int, std::less<int>, 8>>();
+    CheckMoveOnlyRange<DataStructures::LinkedListPriorityQueue<std::unique_ptr<int>, int>>();
+    CheckMoveOnlyRange<DataStructures::SortedLinkedListPriorityQueue<std::unique_ptr<int>, int>>();
+    CheckMoveOnlyRange<DataStructures::SortedDynamicArrayPriorityQueue<std::unique_ptr<int>, int>>();
+    CheckMoveOnlyRange<DataStructures::SkipListPriorityQueue<std::unique_ptr<int>, int>>();
+    CheckMoveOnlyRange<DataStructures::PairingHeapPriorityQueue<std::unique_ptr<int>, int>>();
+    CheckMoveOnlyRange<DataStructures::MinMaxHeapPriorityQueue<std::unique_ptr<int>, int>>();
+    CheckMoveOnlyRange<DataStructures::RadixHeapPriorityQueue<std::unique_ptr<int>, int>>();
+    return 0;
+}
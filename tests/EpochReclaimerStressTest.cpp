@@ -0,0 +1,76 @@
+#include "EpochReclaimer.h"
+#include "StressTest.h"
+#include <atomic>
+#include <thread>
+
+namespace
+{
+    struct Node
+    {
+        int value;
+    };
+
+    /// \brief Overwrites the node before deleting it, so a read of a deleted node is a data race seen by
+    /// ThreadSanitizer, and counts the deleted nodes
+    struct CountingDeleter
+    {
+        std::atomic<int> *deleted;
+
+        void operator()(Node *node) const
+        {
+            node->value = -1;
+            delete node;
+            this->deleted->fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+}
+
+int main()
+{
+    const int threadCount = 8;
+    const int perThread = 20000;
+
+    for (int round = 0; round < 4; ++round)
+    {
+        std::atomic<int> deleted = 0;
+        std::atomic<int> created = 1;
+        int deletedBeforeDestruction;
+        {
+            DataStructures::EpochReclaimer<Node, CountingDeleter> reclaimer(CountingDeleter{&deleted});
+            std::atomic<Node *> current = new Node{0};
+
+            DataStructures::DynamicArray<std::thread> threads(threadCount);
+            for (int i = 0; i < threadCount; ++i)
+            {
+                threads.Emplace([&](int thread)
+                {
+                    for (int i = 0; i < perThread; ++i)
+                    {
+                        auto guard = reclaimer.Protect();
+                        Node *node = current.load();
+                        StressTest::Require(node->value >= 0, "node read under a guard is not deleted");
+                        if (i % 2 == 0)
+                        {
+                            Node *replaced = current.exchange(new Node{thread * perThread + i + 1});
+                            created.fetch_add(1, std::memory_order_relaxed);
+                            reclaimer.Retire(replaced);
+                        }
+                    }
+                }, i);
+            }
+
+            for (std::thread &thread: threads)
+            {
+                thread.join();
+            }
+
+            delete current.load();
+            deletedBeforeDestruction = deleted.load();
+        }
+
+        StressTest::Require(deletedBeforeDestruction > 0, "nodes are deleted before the reclaimer is destroyed");
+        StressTest::Require(deleted.load() == created.load() - 1, "every retired node is deleted once");
+    }
+
+    return 0;
+}
@@ -0,0 +1,57 @@
+#include "FlatCombiningPriorityQueue.h"
+#include "StressTest.h"
+#include <memory>
+
+namespace
+{
+    /// \brief Passes the elements of the stress test through a queue of move-only payloads
+    class MoveOnlyQueue
+    {
+    public:
+        int GetCount() const
+        {
+            return this->queue.GetCount();
+        }
+
+        void Enqueue(int element, int priority)
+        {
+            this->queue.Enqueue(std::make_unique<int>(element), priority);
+        }
+
+        bool TryDequeue(int &element)
+        {
+            std::unique_ptr<int> payload;
+            if (!this->queue.TryDequeue(payload))
+            {
+                return false;
+            }
+
+            StressTest::Require(payload != nullptr, "dequeued payload is not empty");
+            element = *payload;
+            return true;
+        }
+
+    private:
+        DataStructures::FlatCombiningPriorityQueue<std::unique_ptr<int>, int> queue;
+    };
+}
+
+int main()
+{
+    const int threadCount = 8;
+    const int perThread = 2000;
+
+    for (int round = 0; round < 2; ++round)
+    {
+        DataStructures::FlatCombiningPriorityQueue<int, int> queue;
+        StressTest::Run(queue, threadCount, perThread);
+    }
+
+    for (int round = 0; round < 2; ++round)
+    {
+        MoveOnlyQueue queue;
+        StressTest::Run(queue, threadCount, perThread);
+    }
+
+    return 0;
+}
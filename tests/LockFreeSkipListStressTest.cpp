@@ -0,0 +1,37 @@
+#include "LockFreeSkipListPriorityQueue.h"
+#include "StressTest.h"
+#include <stdexcept>
+
+int main()
+{
+    const int threadCount = 8;
+    const int perThread = 5000;
+
+    for (int round = 0; round < 2; ++round)
+    {
+        DataStructures::LockFreeSkipListPriorityQueue<int, int> queue;
+        StressTest::Run(queue, threadCount, perThread);
+    }
+
+    // Modify unieważnia węzeł i wstawia jego kopię, a priorytet się nie zmienia, więc kolejność nadal da się sprawdzić
+    for (int round = 0; round < 2; ++round)
+    {
+        DataStructures::LockFreeSkipListPriorityQueue<int, int> queue;
+        StressTest::Run(queue, threadCount, perThread, [](auto &target, int, int element)
+        {
+            if (element % 16 == 0)
+            {
+                try
+                {
+                    target.Modify(element, StressTest::PriorityOf(element));
+                }
+                catch (const std::runtime_error &)
+                {
+                    // Element został już zdjęty przez inny wątek
+                }
+            }
+        });
+    }
+
+    return 0;
+}
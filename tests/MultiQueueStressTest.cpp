@@ -0,0 +1,110 @@
+#include "MultiQueue.h"
+#include "StressTest.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace
+{
+    /// \brief Runs producers enqueueing repeated values and consumers dequeueing them at the same time, and checks
+    /// that the multiset of the dequeued values equals the multiset of the enqueued ones
+    void CheckConservation(int shardThreads, int factor)
+    {
+        const int producerCount = 4;
+        const int consumerCount = 4;
+        const int perProducer = 20000;
+        const int valueCount = 1000;
+
+        DataStructures::MultiQueue<int, int> queue(shardThreads, factor);
+        auto dequeued = std::make_unique<std::atomic<int>[]>(valueCount);
+        std::atomic<bool> producersDone = false;
+
+        DataStructures::DynamicArray<std::thread> threads(producerCount + consumerCount);
+        for (int i = 0; i < producerCount; ++i)
+        {
+            threads.Emplace([&](int producer)
+            {
+                for (int i = 0; i < perProducer; ++i)
+                {
+                    int element = (producer * perProducer + i) % valueCount;
+                    queue.Enqueue(element, StressTest::PriorityOf(element));
+                }
+            }, i);
+        }
+
+        for (int i = 0; i < consumerCount; ++i)
+        {
+            threads.Emplace([&]()
+            {
+                int element;
+                while (true)
+                {
+                    if (queue.TryDequeue(element))
+                    {
+                        StressTest::Require(element >= 0 && element < valueCount, "dequeued element was enqueued");
+                        dequeued[element].fetch_add(1, std::memory_order_relaxed);
+                    }
+                    else if (producersDone.load())
+                    {
+                        // Producenci skończyli przed odczytem flagi, więc ponowna porażka oznacza pustą kolejkę
+                        if (!queue.TryDequeue(element))
+                        {
+                            return;
+                        }
+
+                        dequeued[element].fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+        }
+
+        for (int i = 0; i < producerCount; ++i)
+        {
+            threads[i].join();
+        }
+
+        producersDone.store(true);
+        for (int i = producerCount; i < producerCount + consumerCount; ++i)
+        {
+            threads[i].join();
+        }
+
+        StressTest::Require(queue.GetCount() == 0, "queue is empty after the consumers finish");
+        for (int i = 0; i < valueCount; ++i)
+        {
+            StressTest::Require(dequeued[i].load() == producerCount * perProducer / valueCount,
+                                "every value dequeued as many times as enqueued");
+        }
+
+        DataStructures::MultiQueueStatistics statistics = queue.GetStatistics();
+        StressTest::Require(statistics.enqueues == producerCount * perProducer, "statistics count the enqueues");
+        StressTest::Require(statistics.dequeues == producerCount * perProducer, "statistics count the dequeues");
+    }
+
+    /// \brief Checks that a queue of a single shard is exact, so its dequeues are ordered and its rank error is 0
+    void CheckSingleShard()
+    {
+        const int threadCount = 8;
+        const int perThread = 5000;
+
+        DataStructures::MultiQueue<int, int> queue(1, 1);
+        StressTest::Run(queue, threadCount, perThread);
+
+        DataStructures::MultiQueueStatistics statistics = queue.GetStatistics();
+        StressTest::Require(statistics.rankSamples > 0, "rank error is sampled");
+        StressTest::Require(statistics.rankErrorSum == 0 && statistics.rankErrorMax == 0,
+                            "rank error of a single shard is 0");
+    }
+}
+
+int main()
+{
+    for (int round = 0; round < 2; ++round)
+    {
+        CheckConservation(4, 2);
+        CheckConservation(1, 1);
+    }
+
+    CheckSingleShard();
+    return 0;
+}
@@ -0,0 +1,100 @@
+#ifndef PROJECT2_STRESSTEST_H
+#define PROJECT2_STRESSTEST_H
+
+#include "DynamicArray.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+namespace StressTest
+{
+    /// \brief Reports the failed check and ends the test with a non-zero exit code
+    /// \param condition A condition, which must hold
+    /// \param message A description of the condition
+    inline void Require(bool condition, const char *message)
+    {
+        if (!condition)
+        {
+            std::cerr << "Check failed: " << message << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    /// \brief Returns the priority of the \p element. The priority depends on the element only, so the order of
+    /// the dequeued elements can be checked, and different elements may have equal priorities.
+    inline int PriorityOf(int element)
+    {
+        return static_cast<int>((static_cast<std::uint32_t>(element) * 2654435761u) >> 16);
+    }
+
+    /// \brief Runs \p threadCount threads, every one enqueueing \p perThread distinct elements and trying to dequeue
+    /// after every second Enqueue, then drains the queue on a single thread. Checks that every element is dequeued
+    /// exactly once, and that the drained priorities do not increase.
+    /// \param queue An empty queue safe to use concurrently
+    /// \param hook A function called with the queue, the thread and the element after every Enqueue
+    template<typename Queue, typename Hook>
+    void Run(Queue &queue, int threadCount, int perThread, Hook &&hook)
+    {
+        int total = threadCount * perThread;
+        auto seen = std::make_unique<std::atomic<int>[]>(total);
+        auto record = [&](int element)
+        {
+            Require(element >= 0 && element < total, "dequeued element was enqueued");
+            Require(seen[element].fetch_add(1, std::memory_order_relaxed) == 0, "element dequeued once");
+        };
+
+        DataStructures::DynamicArray<std::thread> threads(threadCount);
+        for (int i = 0; i < threadCount; ++i)
+        {
+            threads.Emplace([&](int thread)
+            {
+                int element;
+                for (int i = 0; i < perThread; ++i)
+                {
+                    int enqueued = thread * perThread + i;
+                    queue.Enqueue(enqueued, PriorityOf(enqueued));
+                    hook(queue, thread, enqueued);
+                    if (i % 2 == 1 && queue.TryDequeue(element))
+                    {
+                        record(element);
+                    }
+                }
+            }, i);
+        }
+
+        for (std::thread &thread: threads)
+        {
+            thread.join();
+        }
+
+        int element;
+        bool first = true;
+        int last = 0;
+        while (queue.TryDequeue(element))
+        {
+            record(element);
+            Require(first || PriorityOf(element) <= last, "drained priorities do not increase");
+            first = false;
+            last = PriorityOf(element);
+        }
+
+        Require(queue.GetCount() == 0, "queue is empty after draining");
+        for (int i = 0; i < total; ++i)
+        {
+            Require(seen[i].load(std::memory_order_relaxed) == 1, "every element dequeued");
+        }
+    }
+
+    template<typename Queue>
+    void Run(Queue &queue, int threadCount, int perThread)
+    {
+        Run(queue, threadCount, perThread, [](Queue &, int, int)
+        {
+        });
+    }
+}
+
+#endif //PROJECT2_STRESSTEST_H